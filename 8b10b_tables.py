@@ -1,14 +1,96 @@
-with open('8b10b_codes.txt', 'rb') as f:
-    lines = f.readlines()
-    for idx, line in enumerate(lines):
-        if idx < 4:
-            continue
-        line = line.strip()
-        if not line:
-            continue
-        code, data, neg, pos = line.split()
-        data = int(data,2)
-        neg = int(neg, 2)
-        pos = int(pos, 2)
+import sys
+
+# Flags packed into decode8b10bSymbolUtils::SymbolInfo::mFlags, keep in sync with decode8b10bSymbolUtils.h
+SYMBOL_VALID = 0x01
+SYMBOL_CONTROL = 0x02
+DISPARITY_SHIFT = 2
+DISPARITY_NEGATIVE = 0
+DISPARITY_POSITIVE = 1
+DISPARITY_SAME = 2
+
+
+def read_codes():
+    codes = []
+    with open('8b10b_codes.txt', 'rb') as f:
+        lines = f.readlines()
+        for idx, line in enumerate(lines):
+            if idx < 4:
+                continue
+            line = line.strip()
+            if not line:
+                continue
+            code, data, neg, pos = line.decode().split()
+            codes.append((code, int(data, 2), int(neg, 2), int(pos, 2)))
+    return codes
+
+
+def symbol_name(code):
+    # D03.1 -> D3.1, matching decode8b10bSymbolUtils::GetSymbolName
+    return code[0] + str(int(code[1:3])) + code[3:]
+
+
+def print_decode_map(codes):
+    for code, data, neg, pos in codes:
         #{0x274, 0x00}, {0x18B, 0x00},  // D0.0: 1001110100 RD-, 0110001011 RD+
-        print("{{{2:#05x}, {1:#04x}}}, {{{3:#05x}, {1:#04x}}}, // {0}: {2:#012b} RD-, {3:#012b} RD+".format(str(code), data, neg, pos))
\ No newline at end of file
+        print("{{{2:#05x}, {1:#04x}}}, {{{3:#05x}, {1:#04x}}}, // {0}: {2:#012b} RD-, {3:#012b} RD+".format(code, data, neg, pos))
+
+
+def print_symbol_table(codes):
+    # One entry per possible 10-bit pattern: { decoded value, name index, ones count, flags }
+    # Name indices follow decode8b10bSymbolUtils' name table: D-characters by value, then K-characters
+    # in file order, with the last slot reserved for unknown patterns.
+    k_codes = [code for code, data, neg, pos in codes if data & 0x100]
+    unknown_index = 256 + len(k_codes)
+    table = [None] * 1024
+    names = [None] * 1024
+    for code, data, neg, pos in codes:
+        name_index = 256 + k_codes.index(code) if data & 0x100 else data
+        control = SYMBOL_CONTROL if data & 0x100 else 0
+        if neg == pos:
+            columns = [(neg, DISPARITY_SAME)]
+        else:
+            columns = [(neg, DISPARITY_NEGATIVE), (pos, DISPARITY_POSITIVE)]
+        for pattern, disparity in columns:
+            assert table[pattern] is None, "duplicate 10-bit pattern {:#05x}".format(pattern)
+            table[pattern] = (data, name_index, SYMBOL_VALID | control | (disparity << DISPARITY_SHIFT))
+            names[pattern] = symbol_name(code)
+
+    for row in range(0, 1024, 8):
+        entries = []
+        for pattern in range(row, row + 8):
+            ones = bin(pattern).count('1')
+            data, name_index, flags = table[pattern] if table[pattern] else (0, unknown_index, 0)
+            entries.append("{{ {:#05x}, {}, {}, {:#04x} }}".format(data, name_index, ones, flags))
+        valid = [names[p] for p in range(row, row + 8) if names[p]]
+        comment = " // {:#05x}".format(row)
+        if valid:
+            comment += ": " + " ".join(valid)
+        print("\t" + ", ".join(entries) + "," + comment)
+
+
+def print_encode_table(codes):
+    # One entry per 9-bit decoded value (bit 8 set for K-characters): { RD- code, RD+ code }
+    # Values with no 8b/10b character, i.e. most K values, encode as 0.
+    table = [(0, 0)] * 512
+    names = [None] * 512
+    for code, data, neg, pos in codes:
+        table[data] = (neg, pos)
+        names[data] = symbol_name(code)
+
+    for row in range(0, 512, 8):
+        entries = ["{{ {:#05x}, {:#05x} }}".format(*table[value]) for value in range(row, row + 8)]
+        valid = [names[v] for v in range(row, row + 8) if names[v]]
+        comment = " // {:#05x}".format(row)
+        if valid:
+            comment += ": " + " ".join(valid)
+        print("\t" + ", ".join(entries) + "," + comment)
+
+
+if __name__ == '__main__':
+    codes = read_codes()
+    if len(sys.argv) > 1 and sys.argv[1] == '--symbol-table':
+        print_symbol_table(codes)
+    elif len(sys.argv) > 1 and sys.argv[1] == '--encode-table':
+        print_encode_table(codes)
+    else:
+        print_decode_map(codes)
@@ -0,0 +1,415 @@
+// Decode throughput benchmarks: symbol table lookups, comma search, the full decoder core over synthetic
+// bitstreams and CSV export formatting. Each case repeats until it has run for --min-time seconds and reports
+// the time per symbol and symbols per second, Google Benchmark style but with no dependency beyond the SDK.
+// Build with -DDECODE8B10B_BUILD_BENCHMARKS=ON and run decode8b10bBenchmark [--filter <text>] [--min-time <s>].
+
+#include "decode8b10bAnalyzerResults.h"
+#include "decode8b10bDecodePipeline.h"
+#include "decode8b10bDecoderCore.h"
+#include "decode8b10bEdgeSource.h"
+#include "decode8b10bOrderedSetDecoder.h"
+#include "decode8b10bSymbolUtils.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <string>
+#include <vector>
+
+// Decoded values of the characters in the synthetic traffic
+enum
+{
+	K28_5 = 0x1BC,
+	D5_6 = 0xC5,
+	D16_2 = 0x50
+};
+
+// Results are folded in here so the optimizer cannot drop the work being timed
+static U64 gChecksum = 0;
+
+static U32 NextRandom( U32& state )
+{
+	state = state * 1664525 + 1013904223;
+	return state >> 8;
+}
+
+// Encoded symbols, half the ordered sets idle for idle_percent = 50. The stream always opens with idle so the
+// decoder finds a comma even when no idle is asked for.
+static std::vector<U16> MakeCodeStream( U64 num_symbols, U32 idle_percent )
+{
+	std::vector<U16> codes;
+	codes.reserve( num_symbols );
+	U8 running_disparity = 0;
+	U32 random_state = 0x8b10b;
+
+	while( codes.size() < num_symbols )
+	{
+		bool idle = codes.size() < 8 || NextRandom( random_state ) % 100 < idle_percent;
+		if( idle )
+		{
+			codes.push_back( decode8b10bSymbolUtils::EncodeSymbol( K28_5, running_disparity ) );
+			codes.push_back( decode8b10bSymbolUtils::EncodeSymbol( running_disparity == 1 ? D16_2 : D5_6, running_disparity ) );
+		}
+		else
+		{
+			codes.push_back( decode8b10bSymbolUtils::EncodeSymbol( NextRandom( random_state ) & 0xFF, running_disparity ) );
+			codes.push_back( decode8b10bSymbolUtils::EncodeSymbol( NextRandom( random_state ) & 0xFF, running_disparity ) );
+		}
+	}
+	return codes;
+}
+
+// Mostly valid codes with the occasional corrupted pattern, for the table lookups
+static std::vector<U16> MakeLookupStream( U64 num_symbols )
+{
+	std::vector<U16> valid_codes;
+	for( U16 code = 0; code < 1024; code++ )
+	{
+		if( decode8b10bSymbolUtils::IsValid( decode8b10bSymbolUtils::LookupSymbol( code ) ) )
+			valid_codes.push_back( code );
+	}
+
+	std::vector<U16> stream( num_symbols );
+	U32 random_state = 0x8b10b;
+	for( U64 i = 0; i < num_symbols; i++ )
+	{
+		U32 random = NextRandom( random_state );
+		stream[ i ] = ( random >> 16 ) == 0 ? U16( random & 0x3FF ) : valid_codes[ random % valid_codes.size() ];
+	}
+	return stream;
+}
+
+// LSB-first wire bitstream packed newest bit in bit 0, 64 bits per word
+static std::vector<U64> MakeBitWords( const std::vector<U16>& codes )
+{
+	std::vector<U64> words;
+	U64 word = 0;
+	U32 bits = 0;
+	for( U16 code : codes )
+	{
+		for( int bit = 9; bit >= 0; bit-- )
+		{
+			word = ( word << 1 ) | ( ( code >> bit ) & 1 );
+			if( ++bits == 64 )
+			{
+				words.push_back( word );
+				bits = 0;
+			}
+		}
+	}
+	return words;
+}
+
+// A capture of the bitstream at samples_per_bit samples per bit, as the edge list a sample source walks
+struct SyntheticCapture
+{
+	std::vector<U64> mEdges;
+	BitState mInitialState;
+	U64 mSymbols;
+};
+
+static SyntheticCapture MakeCapture( const std::vector<U16>& codes, U32 samples_per_bit )
+{
+	SyntheticCapture capture;
+	capture.mInitialState = ( codes[ 0 ] & 0x200 ) ? BIT_HIGH : BIT_LOW;
+	capture.mSymbols = codes.size();
+
+	U16 level = ( capture.mInitialState == BIT_HIGH ) ? 1 : 0;
+	U64 bit_index = 0;
+	for( U16 code : codes )
+	{
+		for( int bit = 9; bit >= 0; bit--, bit_index++ )
+		{
+			U16 value = ( code >> bit ) & 1;
+			if( value != level )
+			{
+				capture.mEdges.push_back( 100 + bit_index * samples_per_bit );
+				level = value;
+			}
+		}
+	}
+	// Closing edge so the last run has an end
+	capture.mEdges.push_back( 100 + bit_index * samples_per_bit );
+	return capture;
+}
+
+class CountingSink
+{
+public:
+	CountingSink() : mSymbols( 0 ), mChecksum( 0 ) {}
+
+	void OnSymbolDecoded( const decode8b10bSymbolDecoder::Symbol& symbol )
+	{
+		mSymbols++;
+		mChecksum += symbol.mDecoded + symbol.mError;
+	}
+
+	void OnSyncEvent( const decode8b10bSymbolDecoder::SyncEvent& sync )
+	{
+		mChecksum += sync.mHuntedBits;
+	}
+
+	void OnSyncLost( U64 /*sample*/ )
+	{
+	}
+
+	U64 mSymbols;
+	U64 mChecksum;
+};
+
+// Symbols through the ordered set and packet layer as well
+class OrderedSetSink : public CountingSink, public decode8b10bOrderedSetDecoder::Listener
+{
+public:
+	void OnSymbolDecoded( const decode8b10bSymbolDecoder::Symbol& symbol )
+	{
+		mSymbols++;
+		mOrderedSetDecoder.AddSymbol( symbol, *this );
+	}
+
+	virtual void OnSymbol( const decode8b10bOrderedSetDecoder::Symbol& symbol )
+	{
+		mChecksum += symbol.mDecoded;
+	}
+
+	virtual void OnOrderedSet( const decode8b10bOrderedSetDecoder::OrderedSet& ordered_set )
+	{
+		mChecksum += ordered_set.mType;
+	}
+
+	virtual void OnPacket( const decode8b10bOrderedSetDecoder::Packet& packet )
+	{
+		mChecksum += packet.mBytes.size();
+	}
+
+	decode8b10bOrderedSetDecoder mOrderedSetDecoder;
+};
+
+enum Sampling
+{
+	BitByBit,
+	EdgeRuns
+};
+
+template <class Sink>
+static U64 DecodeCapture( const SyntheticCapture& capture, U32 samples_per_bit, Sampling sampling )
+{
+	Sink sink;
+	decode8b10bEdgeSource source( capture.mEdges, capture.mInitialState );
+	decode8b10bDecoderCore<decode8b10bEdgeSource, Sink> core( source, sink );
+	core.Start( U64( samples_per_bit ) << 32, false, 4, 16 );
+	if( sampling == EdgeRuns )
+		core.DecodeEdgeRuns();
+	else
+		core.DecodeBitByBit();
+	core.Finish();
+
+	gChecksum += sink.mChecksum;
+	return sink.mSymbols;
+}
+
+// Plays a single lane's results back onto a sink, as the analyzer does onto itself
+template <class Sink>
+class LaneSink
+{
+public:
+	LaneSink( Sink& sink )
+	:	mSink( sink )
+	{
+	}
+
+	void OnLaneEvent( U32 /*lane*/, const decode8b10bLaneQueue::Event& event )
+	{
+		decode8b10bLaneQueue::Deliver( event, mSink );
+	}
+
+protected:
+	Sink& mSink;
+};
+
+// As the analyzer decodes: the edges are walked on this thread into a ring, decoded on a second thread, and the
+// symbols played back here
+static U64 DecodeThroughRing( const SyntheticCapture& capture, U32 samples_per_bit )
+{
+	decode8b10bEdgeSource source( capture.mEdges, capture.mInitialState );
+	CountingSink sink;
+	LaneSink<CountingSink> lane_sink( sink );
+	U64 start_sample = source.GetSampleNumber();
+	BitState start_state = source.GetBitState();
+
+	decode8b10bDecodePipeline pipeline;
+	pipeline.Start( 1, false, [&]( U32 /*lane*/, decode8b10bEdgeRing& ring, decode8b10bLaneQueue& queue ) {
+		decode8b10bRingSource edges( ring, start_sample, start_state );
+		decode8b10bDecoderCore<decode8b10bRingSource, decode8b10bLaneQueue> core( edges, queue );
+		core.Start( U64( samples_per_bit ) << 32, false, 4, 16 );
+		core.DecodeEdgeRuns();
+		core.Finish();
+	} );
+	for( U32 spins = 0; ; )
+	{
+		bool fed;
+		bool took;
+		pipeline.Fill( 0, source, false, fed );
+		if( !pipeline.Drain( lane_sink, took ) )
+			break;
+		spins = fed || took ? 0 : spins + 1;
+		decode8b10bEdgeRing::Backoff( spins );
+	}
+	pipeline.Finish();
+
+	gChecksum += sink.mChecksum;
+	return sink.mSymbols;
+}
+
+// Symbol frames as the analyzer adds them, for the export formatting cases
+static std::vector<Frame> MakeSymbolFrames( const std::vector<U16>& codes )
+{
+	std::vector<Frame> frames( codes.size() );
+	for( U64 i = 0; i < codes.size(); i++ )
+	{
+		const decode8b10bSymbolUtils::SymbolInfo& symbol = decode8b10bSymbolUtils::LookupSymbol( codes[ i ] );
+		bool is_valid = decode8b10bSymbolUtils::IsValid( symbol );
+
+		Frame& frame = frames[ i ];
+		frame.mStartingSampleInclusive = 100 + i * 100;
+		frame.mEndingSampleInclusive = frame.mStartingSampleInclusive + 99;
+		frame.mData1 = symbol.mDecoded;
+		frame.mData2 = codes[ i ];
+		frame.mType = !is_valid ? decode8b10bAnalyzerResults::ErrorFrame :
+					  decode8b10bSymbolUtils::IsControl( symbol ) ? decode8b10bAnalyzerResults::ControlFrame : decode8b10bAnalyzerResults::DataFrame;
+		frame.mFlags = is_valid ? decode8b10bAnalyzerResults::SymbolValidFlag : 0;
+	}
+	return frames;
+}
+
+struct Benchmark
+{
+	std::string mName;
+	std::function<U64()> mPass; // runs one pass, returns the number of symbols processed
+};
+
+static void RunBenchmark( const Benchmark& benchmark, double min_time )
+{
+	// One untimed pass to warm the caches and tables
+	benchmark.mPass();
+
+	U64 symbols = 0;
+	U64 passes = 0;
+	double seconds = 0;
+	auto start = std::chrono::steady_clock::now();
+	while( seconds < min_time )
+	{
+		symbols += benchmark.mPass();
+		passes++;
+		seconds = std::chrono::duration<double>( std::chrono::steady_clock::now() - start ).count();
+	}
+
+	double ns_per_symbol = seconds * 1e9 / double( symbols );
+	printf( "%-44s %10.2f ns %12.2f M/s %10llu\n", benchmark.mName.c_str(), ns_per_symbol, double( symbols ) / seconds / 1e6,
+			( unsigned long long )passes );
+}
+
+int main( int argc, char** argv )
+{
+	const char* filter = nullptr;
+	double min_time = 0.5;
+	for( int i = 1; i < argc; i++ )
+	{
+		if( !strcmp( argv[ i ], "--filter" ) && i + 1 < argc )
+			filter = argv[ ++i ];
+		else if( !strcmp( argv[ i ], "--min-time" ) && i + 1 < argc )
+			min_time = atof( argv[ ++i ] );
+		else
+		{
+			printf( "usage: decode8b10bBenchmark [--filter <text>] [--min-time <seconds>]\n" );
+			return 2;
+		}
+	}
+
+	const U64 num_symbols = 1 << 18;
+	std::vector<Benchmark> benchmarks;
+
+	std::vector<U16> lookup_stream = MakeLookupStream( num_symbols );
+	benchmarks.push_back( { "LookupSymbol", [&]() {
+		for( U16 code : lookup_stream )
+			gChecksum += decode8b10bSymbolUtils::LookupSymbol( code ).mDecoded;
+		return U64( lookup_stream.size() );
+	} } );
+	benchmarks.push_back( { "DecodeSymbol", [&]() {
+		for( U16 code : lookup_stream )
+			gChecksum += std::get<0>( decode8b10bSymbolUtils::DecodeSymbol( code ) );
+		return U64( lookup_stream.size() );
+	} } );
+	benchmarks.push_back( { "GetSymbolName", [&]() {
+		for( U16 code : lookup_stream )
+			gChecksum += U8( decode8b10bSymbolUtils::GetSymbolName( U16( code & 0x1FF ) )[ 1 ] );
+		return U64( lookup_stream.size() );
+	} } );
+
+	// Comma search over a whole word at a time, counted per 10-bit symbol's worth of bits
+	std::vector<U16> mixed_codes = MakeCodeStream( num_symbols, 50 );
+	std::vector<U64> bit_words = MakeBitWords( mixed_codes );
+	benchmarks.push_back( { "FindCommas", [&]() {
+		for( U64 word : bit_words )
+			gChecksum += decode8b10bSymbolUtils::FindCommas( word );
+		return U64( bit_words.size() ) * 64 / 10;
+	} } );
+	benchmarks.push_back( { "FindReversedCommas", [&]() {
+		for( U64 word : bit_words )
+			gChecksum += decode8b10bSymbolUtils::FindReversedCommas( word );
+		return U64( bit_words.size() ) * 64 / 10;
+	} } );
+
+	// Full pipeline, bit recovery through symbol decode, across oversampling ratios and traffic mixes
+	static const U32 samples_per_bit[] = { 4, 10, 25, 100 };
+	static const U32 idle_percent[] = { 0, 50, 100 };
+	std::vector<SyntheticCapture> captures;
+	captures.reserve( 16 );
+	for( U32 idle : idle_percent )
+	{
+		std::vector<U16> codes = MakeCodeStream( num_symbols, idle );
+		for( U32 ratio : samples_per_bit )
+		{
+			captures.push_back( MakeCapture( codes, ratio ) );
+			const SyntheticCapture* capture = &captures.back();
+
+			std::string suffix = "/spb:" + std::to_string( ratio ) + "/idle:" + std::to_string( idle );
+			benchmarks.push_back( { "Pipeline/EdgeRuns" + suffix, [=]() { return DecodeCapture<CountingSink>( *capture, ratio, EdgeRuns ); } } );
+			if( ratio <= 25 )
+				benchmarks.push_back( { "Pipeline/BitByBit" + suffix, [=]() { return DecodeCapture<CountingSink>( *capture, ratio, BitByBit ); } } );
+			if( idle == 50 )
+			{
+				benchmarks.push_back( { "Pipeline/OrderedSets" + suffix, [=]() { return DecodeCapture<OrderedSetSink>( *capture, ratio, EdgeRuns ); } } );
+				benchmarks.push_back( { "Pipeline/EdgeRing" + suffix, [=]() { return DecodeThroughRing( *capture, ratio ); } } );
+			}
+		}
+	}
+
+	// CSV export rows, one per symbol frame
+	std::vector<Frame> frames = MakeSymbolFrames( mixed_codes );
+	static const DisplayBase display_bases[] = { Decimal, Hexadecimal };
+	static const char* const display_base_names[] = { "Decimal", "Hexadecimal" };
+	for( U32 i = 0; i < 2; i++ )
+	{
+		DisplayBase display_base = display_bases[ i ];
+		benchmarks.push_back( { std::string( "ExportCsvRow/" ) + display_base_names[ i ], [&frames, display_base]() {
+			std::string text;
+			text.reserve( frames.size() * 80 );
+			for( const Frame& frame : frames )
+				decode8b10bAnalyzerResults::FormatCsvRow( frame, 0, 100000000, display_base, text );
+			gChecksum += text.size();
+			return U64( frames.size() );
+		} } );
+	}
+
+	printf( "%-44s %13s %14s %10s\n", "Benchmark", "Time/symbol", "Symbols/s", "Passes" );
+	for( const Benchmark& benchmark : benchmarks )
+	{
+		if( filter == nullptr || benchmark.mName.find( filter ) != std::string::npos )
+			RunBenchmark( benchmark, min_time );
+	}
+	printf( "(checksum %llu)\n", ( unsigned long long )gChecksum );
+
+	return 0;
+}
@@ -0,0 +1,111 @@
+// Compares the direct-indexed symbol table against the std::map lookups it replaced.
+// Build with -DDECODE8B10B_BUILD_BENCHMARKS=ON and run decode8b10bSymbolBenchmark.
+
+#include "decode8b10bSymbolUtils.h"
+#include <chrono>
+#include <cstdio>
+#include <map>
+#include <utility>
+#include <vector>
+
+typedef decode8b10bSymbolUtils::Disparity Disparity;
+
+// Rebuilds the two maps the decoder used to search for every symbol
+struct LegacyMaps
+{
+	std::map<U16, std::pair<U16, Disparity>> mDecodeMap;
+	std::map<U16, const char*> mNameMap;
+
+	LegacyMaps()
+	{
+		for( U16 code = 0; code < 1024; code++ )
+		{
+			const decode8b10bSymbolUtils::SymbolInfo& symbol = decode8b10bSymbolUtils::LookupSymbol( code );
+			if( !decode8b10bSymbolUtils::IsValid( symbol ) )
+				continue;
+
+			mDecodeMap[ code ] = std::make_pair( symbol.mDecoded, decode8b10bSymbolUtils::GetDisparity( symbol ) );
+			mNameMap[ symbol.mDecoded ] = decode8b10bSymbolUtils::GetSymbolName( symbol );
+		}
+	}
+};
+
+static std::vector<U16> MakeSymbolStream( size_t count )
+{
+	std::vector<U16> valid_codes;
+	for( U16 code = 0; code < 1024; code++ )
+	{
+		if( decode8b10bSymbolUtils::IsValid( decode8b10bSymbolUtils::LookupSymbol( code ) ) )
+			valid_codes.push_back( code );
+	}
+
+	// Mostly valid traffic with the occasional corrupted pattern
+	std::vector<U16> stream( count );
+	U32 state = 0x8b10b;
+	for( size_t i = 0; i < count; i++ )
+	{
+		state = state * 1664525 + 1013904223;
+		if( ( state >> 24 ) == 0 )
+			stream[ i ] = U16( state >> 8 ) & 0x3FF;
+		else
+			stream[ i ] = valid_codes[ ( state >> 8 ) % valid_codes.size() ];
+	}
+	return stream;
+}
+
+template <typename Fn>
+static double TimeNsPerSymbol( const std::vector<U16>& stream, int passes, Fn&& fn )
+{
+	auto start = std::chrono::steady_clock::now();
+	for( int pass = 0; pass < passes; pass++ )
+	{
+		for( U16 code : stream )
+			fn( code );
+	}
+	auto elapsed = std::chrono::duration<double, std::nano>( std::chrono::steady_clock::now() - start );
+	return elapsed.count() / ( double( stream.size() ) * passes );
+}
+
+int main()
+{
+	const size_t num_symbols = 1 << 20;
+	const int passes = 20;
+
+	LegacyMaps legacy;
+	std::vector<U16> stream = MakeSymbolStream( num_symbols );
+
+	// Accumulated so the optimizer cannot drop the lookups
+	U64 map_checksum = 0;
+	U64 table_checksum = 0;
+
+	double map_ns = TimeNsPerSymbol( stream, passes, [&]( U16 code ) {
+		auto it = legacy.mDecodeMap.find( code );
+		U16 decoded = 0;
+		Disparity disparity = Disparity::Negative;
+		if( it != legacy.mDecodeMap.end() )
+		{
+			decoded = it->second.first;
+			disparity = it->second.second;
+		}
+		auto name = legacy.mNameMap.find( decoded );
+		U8 ones = 0;
+		for( int i = 0; i < 10; i++ )
+			ones += ( code >> i ) & 1;
+		map_checksum += decoded + U64( disparity ) + ones + ( name != legacy.mNameMap.end() ? name->second[ 0 ] : 0 );
+	} );
+
+	double table_ns = TimeNsPerSymbol( stream, passes, [&]( U16 code ) {
+		const decode8b10bSymbolUtils::SymbolInfo& symbol = decode8b10bSymbolUtils::LookupSymbol( code );
+		U16 decoded = decode8b10bSymbolUtils::IsValid( symbol ) ? symbol.mDecoded : 0;
+		table_checksum +=
+		    decoded + U64( decode8b10bSymbolUtils::GetDisparity( symbol ) ) + symbol.mOnesCount + decode8b10bSymbolUtils::GetSymbolName( symbol )[ 0 ];
+	} );
+
+	printf( "symbols per pass: %zu, passes: %d\n", num_symbols, passes );
+	printf( "std::map decode + name: %8.2f ns/symbol (%6.1f Msymbols/s)\n", map_ns, 1e3 / map_ns );
+	printf( "table decode + name:    %8.2f ns/symbol (%6.1f Msymbols/s)\n", table_ns, 1e3 / table_ns );
+	printf( "speedup: %.1fx\n", map_ns / table_ns );
+	printf( "(checksum %llu)\n", ( unsigned long long )( map_checksum ^ table_checksum ) );
+
+	return 0;
+}
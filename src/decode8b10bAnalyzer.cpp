@@ -1,9 +1,14 @@
 #include "decode8b10bAnalyzer.h"
 #include "decode8b10bAnalyzerSettings.h"
 #include "decode8b10bSymbolUtils.h"
+#include "decode8b10bDecoderCore.h"
+#include "decode8b10bReplaySource.h"
 #include <AnalyzerChannelData.h>
-#include <vector>
-#include <map>
+#include <algorithm>
+#include <cstdio>
+
+static_assert( int( decode8b10bAnalyzerSettings::MaxLanes ) == int( decode8b10bLaneDeskew::MaxLanes ), "lane settings and deskew disagree on the lane limit" );
+static_assert( int( decode8b10bDecodePipeline::MaxLanes ) == int( decode8b10bLaneDeskew::MaxLanes ), "pipeline and deskew disagree on the lane limit" );
 
 decode8b10bAnalyzer::decode8b10bAnalyzer()
 :	Analyzer2(),  
@@ -32,234 +37,558 @@ void decode8b10bAnalyzer::WorkerThread()
 {
 	mSampleRateHz = GetSampleRate();
 	mSerial = GetAnalyzerChannelData( mSettings.mInputChannel );
-	U32 index = 0;
-
-	U32 samples_per_bit = mSampleRateHz / mSettings.mBitRate;
-	U32 samples_to_bit_center =  U32( 1.5 * double( mSampleRateHz ) / double( mSettings.mBitRate ) );
-
-	bool drop_idle_frames = mSettings.mDropIdleFrames;
-	bool last_was_k2805 = false; // Track if the last symbol was K28.5
-
-	// K28.5 comma patterns for synchronization
-	const U16 K28_5_RD_MINUS = 0xFA;   // K28.5 RD- as sampled (LSB left)
-	const U16 K28_5_RD_PLUS = 0x305;   // K28.5 RD+ as sampled (LSB left)
-	
-	// Function to reverse bit order of a 10-bit value
-	auto reverse_10_bits = [](U16 value) -> U16 {
-		U16 reversed = 0;
-		for(int i = 0; i < 10; i++) {
-			if(value & (1 << i)) {
-				reversed |= (1 << (9 - i));
-			}
-		}
-		return reversed;
-	};
 
-	// Find first edge to start sampling
-	mSerial->AdvanceToNextEdge();
-	mSerial->AdvanceToNextEdge();
+	mLastWasK28_5 = false;
+	mIdleRunSymbols = 0;
+	mIdleRunOrderedSets = 0;
+	mOrderedSetDecoder.Reset();
 
-	// Move to center of first bit
-	mSerial->Advance( samples_to_bit_center - 1);
+	// Frames are committed in batches
+	mUncommittedFrames = 0;
+	mCommitBatchFrames = 1;
+	mLastFrameSample = 0;
+	mLastCommitSample = 0;
 
-	// Use sliding window to find K28.5 comma
-	U16 sliding_window = 0;
-	U8 running_disparity = 0; // Track running disparity
-	bool synchronized = false;
-	bool first_symbol = true; // Track if this is the first symbol after synchronization
-	bool in_idle = false;
-	std::vector<U64> bit_sample_positions; // Track sample positions that shift with sliding window
+	bool live = ( mSettings.mLiveLatencyMs != 0 );
+	mLiveLatency = std::chrono::milliseconds( mSettings.mLiveLatencyMs );
+	mLastCommitTime = std::chrono::steady_clock::now();
+	mLatencyChecks = 0;
+
+	if( mSettings.mDetectBitRate )
+	{
+		// The channel only moves forward, so the edges read for the detection are replayed to the decoder. Live,
+		// the detection waits for its edges to arrive.
+		U64 start_sample = mSerial->GetSampleNumber();
+		BitState start_state = mSerial->GetBitState();
+		std::vector<U64> edges;
+		while( edges.size() < decode8b10bBitRateDetector::DetectionEdges && ( live || mSerial->DoMoreTransitionsExistInCurrentData() ) )
+		{
+			mSerial->AdvanceToNextEdge();
+			edges.push_back( mSerial->GetSampleNumber() );
+		}
+
+		decode8b10bBitRateDetector::Estimate estimate = decode8b10bBitRateDetector::Detect( edges, mSampleRateHz );
+		AddBitRateFrame( estimate, start_sample, edges.empty() ? start_sample : edges.front() );
 
-	for( ; ; )
+		decode8b10bReplaySource<AnalyzerChannelData> source( *mSerial, edges, start_sample, start_state );
+		Decode( source, estimate.mDetected ? estimate.mBitRate : mSettings.mBitRate );
+	}
+	else
 	{
+		Decode( *mSerial, mSettings.mBitRate );
+	}
 
-		// Store current bit sample position (at bit center)
-		U64 bit_center_position = mSerial->GetSampleNumber();
-		bit_sample_positions.insert(bit_sample_positions.begin(), bit_center_position);
-		if( bit_sample_positions.size() > 10 )
-			bit_sample_positions.pop_back();
-
-		// Sample current bit into sliding window coming lsb 1st but we need to match the bit order with the lsb on the left
-		// for ease of reading the 10-bit value
-		sliding_window <<= 1;
-		sliding_window &= 0x3FF; // Keep only 10 bits in the sliding window
-		if( mSerial->GetBitState() == BIT_HIGH )
-            sliding_window |= 1;
-        if( mSerial->GetBitState() == BIT_LOW )
-			sliding_window &= 0x3FE;
-
-		// Process 8b/10b symbols once we have 10 samples
-		if( bit_sample_positions.size() == 10 )
+	FlushFrames();
+}
+
+template <class Source>
+void decode8b10bAnalyzer::Decode( Source& source, U32 bit_rate )
+{
+	mBitPeriod = decode8b10bSymbolDecoder::GetBitPeriod( mSampleRateHz, bit_rate );
+
+	U32 lane_count = mSettings.GetLaneCount();
+	mLaneCount = lane_count;
+	AnalyzerChannelData* lane_channels[ decode8b10bLaneDeskew::MaxLanes ] = {};
+	U64 start_samples[ decode8b10bLaneDeskew::MaxLanes ] = { source.GetSampleNumber() };
+	BitState start_states[ decode8b10bLaneDeskew::MaxLanes ] = { source.GetBitState() };
+	for( U32 lane = 1; lane < lane_count; lane++ )
+	{
+		lane_channels[ lane ] = GetAnalyzerChannelData( mSettings.mLaneChannels[ lane - 1 ] );
+		start_samples[ lane ] = lane_channels[ lane ]->GetSampleNumber();
+		start_states[ lane ] = lane_channels[ lane ]->GetBitState();
+	}
+	if( lane_count > 1 )
+		mLaneDeskew.Reset( lane_count, U16( mSettings.mAlignmentCharacter ), ( mBitPeriod * 10 ) >> 32, start_samples[ 0 ] );
+	mLaneEndSample = 0;
+
+	// Each lane is decoded on a thread of its own; everything else happens here, on the worker thread. The
+	// channels are walked into the decoders' rings a batch at a time, and what the decoders report comes back to
+	// be turned into frames in between, so the SDK is only ever called from this thread and a lane gone quiet
+	// never holds up the others. Live, the walk waits here for more data, showing what has been decoded once it is
+	// due and noticing a stopped analyzer.
+	bool live = ( mSettings.mLiveLatencyMs != 0 );
+	decode8b10bDecodePipeline pipeline;
+	pipeline.Start( lane_count, live, [&]( U32 lane, decode8b10bEdgeRing& ring, decode8b10bLaneQueue& queue ) {
+		decode8b10bRingSource edges( ring, start_samples[ lane ], start_states[ lane ] );
+		decode8b10bDecoderCore<decode8b10bRingSource, decode8b10bLaneQueue> core( edges, queue );
+		RecoverBits( core );
+
+		// Report a trailing stretch that never regained lock; lanes are lined up by the deskew instead
+		if( lane_count == 1 )
+			core.Finish();
+	} );
+
+	decode8b10bDecodePipeline::Listener& listener = *this;
+	for( U32 spins = 0; ; )
+	{
+		bool any_fed = false;
+		for( U32 lane = 0; lane < lane_count; lane++ )
 		{
-			// Check if we have K28.5 comma pattern to establish synchronization
-			if( !synchronized && ((sliding_window == K28_5_RD_MINUS) || (sliding_window == K28_5_RD_PLUS)) )
-			{
-				synchronized = true;
-				last_was_k2805 = true;
-			}
-
-			// If synchronized, decode every 10-bit symbol
-			if( synchronized )
-			{
-				in_idle = false;
-				auto decode_result = decode8b10bSymbolUtils::DecodeSymbol(sliding_window);
-				U16 decoded_value = std::get<0>(decode_result);
-				decode8b10bSymbolUtils::Disparity disparity = std::get<1>(decode_result);
-				bool is_valid = std::get<2>(decode_result);
-				U8 ones_count = CountOnes(sliding_window);
-				const char* symbol_name = decode8b10bSymbolUtils::GetSymbolName(decoded_value);
-
-				if (decoded_value == 0x1BC || (decoded_value == 0x4A && last_was_k2805)
-										   || (decoded_value == 0xB3 && last_was_k2805))
-				{
-					in_idle = true;
-				}
-				
-				// Skip frame if dropping idle frames is enabled and this is an idle frame
-				if( mSettings.mDropIdleFrames && in_idle )
-				{
-					// Clear positions and advance to next 10-bit symbol
-					bit_sample_positions.clear();
-					sliding_window = 0;
-					first_symbol = false;
-					last_was_k2805 = (decoded_value == 0x1BC && is_valid); // Update last_was_k2805 only if we just processed K28.5
-					// Deal with disparity even though we are skipping the frame
-					// TODO: no errors logged
-					if (ones_count > 5 && running_disparity == 0)
-					{
-						running_disparity = 1; // Set running disparity to positive
-					}
-					else if (ones_count < 5 && running_disparity == 1)
-					{
-						running_disparity = 0; // Set running disparity to negative
-					}
-
-					// Move to next bit center
-					if (mSerial->WouldAdvancingCauseTransition( samples_per_bit ) == false)
-					{
-						// No transition, just advance
-						mSerial->Advance( samples_per_bit );
-					}
-					else
-					{
-						// Transition detected, advance to next edge
-						mSerial->AdvanceToNextEdge();
-						mSerial->Advance( samples_to_bit_center - samples_per_bit);
-					}
-
-					// Check for end of data
-					if( mSerial->DoMoreTransitionsExistInCurrentData() == false )
-						break;
-					continue;
-				}
-
-				// Create frame for this 8b/10b symbol
-				Frame frame;
-				frame.mData1 = decoded_value; // 8-bit decoded value
-				frame.mData2 = sliding_window; // Store 10-bit raw value in mData2
-				frame.mFlags = is_valid ? 1 : 0; // Valid symbol flag
-				frame.mStartingSampleInclusive = bit_sample_positions.back() - samples_per_bit/2;
-				frame.mEndingSampleInclusive = bit_sample_positions.front() + samples_per_bit/2;
-	
-				// Use shared utility for symbol naming
-
-				FrameV2 frame_v2;
-
-				if (ones_count > 5 && running_disparity == 0)
-				{
-					running_disparity = 1; // Set running disparity to positive
-				}
-				else if (ones_count < 5 && running_disparity == 1)
-				{
-					running_disparity = 0; // Set running disparity to negative
-				}
-				else if (!first_symbol && ones_count > 5 && running_disparity == 1)
-				{
-					frame_v2.AddString("Error", "Disparity mismatch: too many ones");
-				}
-				else if (!first_symbol && ones_count < 5 && running_disparity == 0)
-				{
-					frame_v2.AddString("Error", "Disparity mismatch: too many zeros");
-				}
-				
-				
-	            frame_v2.AddString("Name", symbol_name);
- 				frame_v2.AddInteger("Decoded Octet", decoded_value);
-
-				char disp_str[32];
-				if( disparity == decode8b10bSymbolUtils::Disparity::Positive )
-				{
-					sprintf( disp_str, "+" );
-				}
-				else if( disparity == decode8b10bSymbolUtils::Disparity::Negative )
-				{
-					sprintf( disp_str, "-" );
-				}
-				else
-				{
-					sprintf( disp_str, "neutral" );
-				}
-
-				frame_v2.AddString("Disparity", disp_str);
-				
-				// Determine frame type: K28.5=Control(1), Data=Data(0), Invalid=Error(2)
-				if( !is_valid )
-				{
-					frame.mType = 2; // Error
-					mResults->AddFrameV2( frame_v2, "error", frame.mStartingSampleInclusive, frame.mEndingSampleInclusive );
-				}
-				else if( decoded_value >= 0xFF ) // Control char
-				{
-					frame.mType = 1; // Control
-					mResults->AddFrameV2( frame_v2, "control", frame.mStartingSampleInclusive, frame.mEndingSampleInclusive );
-				}
-				else
-				{
-					frame.mType = 0; // Data
-					mResults->AddFrameV2( frame_v2, "data", frame.mStartingSampleInclusive, frame.mEndingSampleInclusive );
-				}
-				
-
-				mResults->AddFrame( frame );
-				mResults->CommitResults();
-				ReportProgress( frame.mEndingSampleInclusive );
-
-				// Clear positions and advance to next 10-bit symbol
-				bit_sample_positions.clear();
-				sliding_window = 0;
-				first_symbol = false; // After first symbol, we are no longer in the initial state
-			}
+			bool fed;
+			if( lane == 0 )
+				pipeline.Fill( lane, source, live, fed );
+			else
+				pipeline.Fill( lane, *lane_channels[ lane ], live, fed );
+			any_fed = any_fed || fed;
 		}
 
-		// Move to next bit center
-		if (mSerial->WouldAdvancingCauseTransition( samples_per_bit ) == false)
+		bool idle = live && pipeline.TakeIdle();
+		bool took;
+		if( !pipeline.Drain( listener, took ) )
+			break;
+
+		// The decoders have caught up with the capture; what they held is shown once it is due, even mid idle run
+		if( idle && std::chrono::steady_clock::now() - mLastCommitTime >= mLiveLatency )
 		{
-			// No transition, just advance
-			mSerial->Advance( samples_per_bit );
+			FlushIdleRun();
+			FlushFrames();
 		}
-		else
+		if( any_fed || took )
 		{
-			// Transition detected, advance to next edge
-			mSerial->AdvanceToNextEdge();
-			mSerial->Advance( samples_to_bit_center - samples_per_bit);
+			spins = 0;
+			continue;
 		}
 
-		// Check for end of data
-		if( mSerial->DoMoreTransitionsExistInCurrentData() == false )
-			break;
+		// Waiting on the decoders or, live, on the capture, which is where a stopped analyzer would go unnoticed
+		if( live )
+			CheckIfThreadShouldExit();
+		decode8b10bEdgeRing::Backoff( ++spins );
+	}
+	pipeline.Finish();
+
+	if( lane_count > 1 )
+	{
+		// Report a trailing stretch the lanes never lined up in
+		mLaneDeskew.Finish( mLaneEndSample, *this );
+	}
+	else
+	{
+		mOrderedSetDecoder.Flush( *this );
+		FlushIdleRun();
 	}
 }
 
-U8 decode8b10bAnalyzer::CountOnes(U16 value)
+void decode8b10bAnalyzer::OnLaneEvent( U32 lane, const decode8b10bLaneQueue::Event& event )
 {
-	U8 count = 0;
-	// Count '1' bits in the 10-bit value by checking each bit position
-	for(int i = 0; i < 10; i++) {
-		if(value & 0x3FF & (1 << i)) {
-			count++;
+	// A single lane's results are taken as the decoder reported them
+	if( mLaneCount == 1 )
+	{
+		decode8b10bSymbolDecoder::Listener& listener = *this;
+		decode8b10bLaneQueue::Deliver( event, listener );
+		return;
+	}
+
+	// Lanes go to the deskew in order of start sample. Regaining lock is not passed on, the lanes are lined up
+	// again from the symbols that follow.
+	if( event.mType == decode8b10bLaneQueue::SyncLostEvent )
+	{
+		mLaneDeskew.LoseLane( lane, event.mSymbol.mStart, *this );
+	}
+	else if( event.mType == decode8b10bLaneQueue::SymbolDecodedEvent )
+	{
+		mLaneEndSample = std::max( mLaneEndSample, event.mSymbol.mEnd );
+		mLaneDeskew.AddSymbol( lane, event.mSymbol, *this );
+	}
+}
+
+template <class Core>
+void decode8b10bAnalyzer::RecoverBits( Core& core )
+{
+	core.Start( mBitPeriod, mSettings.mBitOrder == decode8b10bAnalyzerSettings::MsbFirst, mSettings.mLossOfSyncErrors,
+				mSettings.mLossOfSyncWindow );
+
+	if( mSettings.mSamplingMode == decode8b10bAnalyzerSettings::ClockRecoverySampling )
+		core.DecodeClockRecovery( mSettings.mPllGainShift );
+	else if( mSettings.mSamplingMode == decode8b10bAnalyzerSettings::EdgeRunSampling )
+		core.DecodeEdgeRuns();
+	else
+		core.DecodeBitByBit();
+}
+
+// Indexed by decode8b10bSymbolUtils::Disparity, spelt as the bubbles and the CSV export spell it after "RD"
+const char* const decode8b10bAnalyzer::sDisparityNames[ 3 ] = { "-", "+", "+/-" };
+const S64 decode8b10bAnalyzer::sCompactDisparity[ 3 ] = { -1, 1, 0 };
+
+const char* const decode8b10bAnalyzer::sLaneNames[ decode8b10bLaneDeskew::MaxLanes ] = { "Lane 0", "Lane 1", "Lane 2", "Lane 3" };
+const char* const decode8b10bAnalyzer::sLaneSkewNames[ decode8b10bLaneDeskew::MaxLanes ] = { "Lane 0 Skew", "Lane 1 Skew", "Lane 2 Skew", "Lane 3 Skew" };
+
+void decode8b10bAnalyzer::OnSymbolDecoded( const decode8b10bSymbolDecoder::Symbol& record )
+{
+	if( mSettings.mProtocolLayer == decode8b10bAnalyzerSettings::OrderedSetLayer )
+		mOrderedSetDecoder.AddSymbol( record, *this ); // comes back through OnSymbol when not part of an ordered set or packet
+	else
+		OnSymbol( record );
+}
+
+void decode8b10bAnalyzer::OnSyncEvent( const decode8b10bSymbolDecoder::SyncEvent& sync )
+{
+	AddSyncFrame( sync );
+}
+
+void decode8b10bAnalyzer::OnSyncLost( U64 /*sample*/ )
+{
+	mOrderedSetDecoder.Flush( *this );
+	FlushIdleRun();
+}
+
+void decode8b10bAnalyzer::OnSymbol( const decode8b10bOrderedSetDecoder::Symbol& record )
+{
+	bool in_idle = false;
+
+	const decode8b10bSymbolUtils::SymbolInfo& symbol = decode8b10bSymbolUtils::LookupSymbol(record.mCode);
+	U16 decoded_value = record.mDecoded;
+	decode8b10bSymbolUtils::Disparity disparity = decode8b10bSymbolUtils::GetDisparity(symbol);
+	bool is_valid = decode8b10bSymbolUtils::IsValid(symbol);
+	const char* symbol_name = decode8b10bSymbolUtils::GetSymbolName(symbol);
+	decode8b10bSymbolDecoder::SymbolError symbol_error = decode8b10bSymbolDecoder::SymbolError( record.mError );
+
+	// Idle ordered sets: K28.5 followed by D10.2, D19.5, D5.6 (/I1/) or D16.2 (/I2/)
+	if (decoded_value == 0x1BC || (decoded_value == 0x4A && mLastWasK28_5)
+							   || (decoded_value == 0xB3 && mLastWasK28_5)
+							   || (decoded_value == 0xC5 && mLastWasK28_5)
+							   || (decoded_value == 0x50 && mLastWasK28_5))
+	{
+		in_idle = true;
+	}
+	mLastWasK28_5 = (decoded_value == 0x1BC && is_valid);
+
+	// Dropping idle only drops error-free idle symbols, an errored one still gets its frame
+	if( mSettings.mIdleMode == decode8b10bAnalyzerSettings::DropIdle && in_idle && symbol_error == decode8b10bSymbolDecoder::NoSymbolError )
+		return;
+
+	// Error-free idle symbols extend the current idle run, anything else ends it and gets its own frame
+	if( mSettings.mIdleMode == decode8b10bAnalyzerSettings::MergeIdle )
+	{
+		if( in_idle && symbol_error == decode8b10bSymbolDecoder::NoSymbolError )
+		{
+			ExtendIdleRun( record.mStart, record.mEnd, decoded_value == 0x1BC ? 1 : 0, 1 );
+			return;
 		}
+
+		FlushIdleRun();
 	}
-	return count;
+
+	// Create frame for this 8b/10b symbol
+	Frame frame;
+	frame.mData1 = decoded_value; // 8-bit decoded value
+	frame.mData2 = record.mCode; // Store 10-bit raw value in mData2
+	frame.mFlags = ( is_valid ? decode8b10bAnalyzerResults::SymbolValidFlag : 0 ) | ( symbol_error << decode8b10bAnalyzerResults::SymbolErrorShift );
+	frame.mStartingSampleInclusive = record.mStart;
+	frame.mEndingSampleInclusive = record.mEnd;
+
+	FrameV2 frame_v2;
+
+	if( mSettings.mFrameV2Schema == decode8b10bAnalyzerSettings::CompactFrameV2 )
+	{
+		// Integers only; the codes are documented next to decode8b10bSymbolDecoder::SymbolError
+		frame_v2.AddInteger("Code", record.mCode);
+		frame_v2.AddInteger("Decoded Octet", decoded_value);
+		frame_v2.AddInteger("Disparity", sCompactDisparity[ int( disparity ) ]);
+		frame_v2.AddInteger("Error", symbol_error);
+	}
+	else
+	{
+		// Disparity mismatches are reported here, invalid codes already show up as the "error" frame type
+		if( symbol_error == decode8b10bSymbolDecoder::TooManyOnesError || symbol_error == decode8b10bSymbolDecoder::TooManyZerosError )
+		{
+			frame_v2.AddString("Error", decode8b10bSymbolDecoder::GetSymbolErrorText( symbol_error ));
+		}
+
+		frame_v2.AddString("Name", symbol_name);
+		frame_v2.AddInteger("Decoded Octet", decoded_value);
+		frame_v2.AddString("Disparity", sDisparityNames[ int( disparity ) ]);
+	}
+
+	// Determine frame type: K-character=Control, Data=Data, Invalid=Error
+	if( !is_valid )
+	{
+		frame.mType = decode8b10bAnalyzerResults::ErrorFrame;
+		mResults->AddFrameV2( frame_v2, "error", frame.mStartingSampleInclusive, frame.mEndingSampleInclusive );
+	}
+	else if( decode8b10bSymbolUtils::IsControl(symbol) ) // Control char
+	{
+		frame.mType = decode8b10bAnalyzerResults::ControlFrame;
+		mResults->AddFrameV2( frame_v2, "control", frame.mStartingSampleInclusive, frame.mEndingSampleInclusive );
+	}
+	else
+	{
+		frame.mType = decode8b10bAnalyzerResults::DataFrame;
+		mResults->AddFrameV2( frame_v2, "data", frame.mStartingSampleInclusive, frame.mEndingSampleInclusive );
+	}
+
+
+	mResults->AddFrame( frame );
+	CommitFrame( frame.mEndingSampleInclusive );
+}
+
+void decode8b10bAnalyzer::OnOrderedSet( const decode8b10bOrderedSetDecoder::OrderedSet& ordered_set )
+{
+	mLastWasK28_5 = false;
+
+	bool is_idle = ( ordered_set.mType == decode8b10bOrderedSetDecoder::IdleSet1 || ordered_set.mType == decode8b10bOrderedSetDecoder::IdleSet2 );
+	if( is_idle && mSettings.mIdleMode == decode8b10bAnalyzerSettings::DropIdle )
+		return;
+	if( is_idle && mSettings.mIdleMode == decode8b10bAnalyzerSettings::MergeIdle )
+	{
+		ExtendIdleRun( ordered_set.mStart, ordered_set.mEnd, 1, 2 );
+		return;
+	}
+
+	FlushIdleRun();
+
+	Frame frame;
+	frame.mData1 = ordered_set.mType;
+	frame.mData2 = ordered_set.mConfigWord;
+	frame.mType = decode8b10bAnalyzerResults::OrderedSetFrame;
+	frame.mFlags = 0;
+	frame.mStartingSampleInclusive = ordered_set.mStart;
+	frame.mEndingSampleInclusive = ordered_set.mEnd;
+
+	FrameV2 frame_v2;
+	if( mSettings.mFrameV2Schema == decode8b10bAnalyzerSettings::CompactFrameV2 )
+		frame_v2.AddInteger( "Ordered Set", ordered_set.mType );
+	else
+		frame_v2.AddString( "Name", decode8b10bOrderedSetDecoder::GetOrderedSetName( ordered_set.mType ) );
+
+	if( ordered_set.mType == decode8b10bOrderedSetDecoder::ConfigSet1 || ordered_set.mType == decode8b10bOrderedSetDecoder::ConfigSet2 )
+		frame_v2.AddInteger( "Config Word", ordered_set.mConfigWord );
+
+	mResults->AddFrameV2( frame_v2, "ordered_set", frame.mStartingSampleInclusive, frame.mEndingSampleInclusive );
+	mResults->AddFrame( frame );
+	CommitFrame( frame.mEndingSampleInclusive );
+}
+
+void decode8b10bAnalyzer::OnPacket( const decode8b10bOrderedSetDecoder::Packet& packet )
+{
+	mLastWasK28_5 = false;
+	FlushIdleRun();
+
+	U32 frame_length = U32( packet.mFrameOffset != 0 ? packet.mBytes.size() - packet.mFrameOffset : 0 );
+	bool packet_ok = packet.mTerminated && packet.mCrcValid && packet.mErrorCount == 0;
+
+	Frame frame;
+	frame.mData1 = frame_length;
+	frame.mData2 = packet.mErrorCount;
+	frame.mType = decode8b10bAnalyzerResults::PacketFrame;
+	frame.mFlags = ( packet.mCrcValid ? decode8b10bAnalyzerResults::PacketCrcValidFlag : 0 ) |
+				   ( packet.mTerminated ? decode8b10bAnalyzerResults::PacketTerminatedFlag : 0 ) |
+				   ( packet.mPreambleValid ? decode8b10bAnalyzerResults::PacketPreambleValidFlag : 0 ) |
+				   ( packet_ok ? 0 : DISPLAY_AS_ERROR_FLAG );
+	frame.mStartingSampleInclusive = packet.mStart;
+	frame.mEndingSampleInclusive = packet.mEnd;
+
+	FrameV2 frame_v2;
+	frame_v2.AddInteger( "Length", frame_length );
+	frame_v2.AddBoolean( "CRC Valid", packet.mCrcValid );
+	frame_v2.AddBoolean( "Preamble Valid", packet.mPreambleValid );
+	frame_v2.AddBoolean( "Terminated", packet.mTerminated );
+	frame_v2.AddInteger( "Symbol Errors", packet.mErrorCount );
+	if( frame_length > 0 )
+		frame_v2.AddByteArray( "Frame", &packet.mBytes[ packet.mFrameOffset ], frame_length );
+
+	// Each packet frame is also an SDK packet, so the packet table can list them
+	mResults->CancelPacketAndStartNewPacket();
+	mResults->AddFrameV2( frame_v2, "packet", frame.mStartingSampleInclusive, frame.mEndingSampleInclusive );
+	mResults->AddFrame( frame );
+	mResults->CommitPacketAndStartNewPacket();
+	CommitFrame( frame.mEndingSampleInclusive );
+}
+
+void decode8b10bAnalyzer::OnColumn( const decode8b10bLaneDeskew::Column& column )
+{
+	// Shown at lane 0's symbol, with the symbol of every lane
+	Frame frame;
+	frame.mData1 = 0;
+	frame.mData2 = 0;
+	frame.mType = decode8b10bAnalyzerResults::ColumnFrame;
+	frame.mStartingSampleInclusive = column.mSymbols[ 0 ].mStart;
+	frame.mEndingSampleInclusive = column.mSymbols[ 0 ].mEnd;
+
+	FrameV2 frame_v2;
+	U32 error_lanes = 0;
+	for( U32 lane = 0; lane < mLaneDeskew.GetLaneCount(); lane++ )
+	{
+		const decode8b10bLaneDeskew::Symbol& record = column.mSymbols[ lane ];
+		U32 shift = decode8b10bAnalyzerResults::ColumnLaneBits * lane;
+		frame.mData1 |= U64( record.mDecoded ) << shift;
+		frame.mData2 |= U64( record.mCode | ( record.mError << decode8b10bAnalyzerResults::ColumnErrorShift ) |
+							 decode8b10bAnalyzerResults::ColumnLanePresentFlag ) << shift;
+		if( record.mError != decode8b10bSymbolDecoder::NoSymbolError )
+			error_lanes |= 1 << lane;
+
+		if( mSettings.mFrameV2Schema == decode8b10bAnalyzerSettings::CompactFrameV2 )
+			frame_v2.AddInteger( sLaneNames[ lane ], record.mDecoded );
+		else
+			frame_v2.AddString( sLaneNames[ lane ], decode8b10bSymbolUtils::GetSymbolName( decode8b10bSymbolUtils::LookupSymbol( record.mCode ) ) );
+	}
+
+	// Bit n set for an error on lane n
+	if( mSettings.mFrameV2Schema == decode8b10bAnalyzerSettings::CompactFrameV2 || error_lanes != 0 )
+		frame_v2.AddInteger( "Error Lanes", error_lanes );
+	if( column.mAlignmentError )
+		frame_v2.AddBoolean( "Alignment Error", true );
+
+	frame.mFlags = ( column.mAlignmentError ? decode8b10bAnalyzerResults::ColumnAlignmentErrorFlag : 0 ) |
+				   ( error_lanes != 0 || column.mAlignmentError ? DISPLAY_AS_ERROR_FLAG : 0 );
+
+	mResults->AddFrameV2( frame_v2, "column", frame.mStartingSampleInclusive, frame.mEndingSampleInclusive );
+	mResults->AddFrame( frame );
+	CommitFrame( frame.mEndingSampleInclusive );
+}
+
+void decode8b10bAnalyzer::OnAlignment( const decode8b10bLaneDeskew::Alignment& alignment )
+{
+	// One frame covers the whole stretch spent lining the lanes up
+	S64 earliest = 0;
+	S64 latest = 0;
+	for( U32 lane = 0; lane < mLaneDeskew.GetLaneCount(); lane++ )
+	{
+		earliest = std::min( earliest, alignment.mSkew[ lane ] );
+		latest = std::max( latest, alignment.mSkew[ lane ] );
+	}
+
+	Frame frame;
+	frame.mData1 = U64( latest - earliest );
+	frame.mData2 = alignment.mDroppedSymbols;
+	frame.mType = decode8b10bAnalyzerResults::AlignmentFrame;
+	frame.mFlags = alignment.mAcquired ? 0 : ( decode8b10bAnalyzerResults::AlignmentNotAcquiredFlag | DISPLAY_AS_WARNING_FLAG );
+	frame.mStartingSampleInclusive = alignment.mUnalignedSince;
+	frame.mEndingSampleInclusive = alignment.mAlignedAt;
+
+	FrameV2 frame_v2;
+	frame_v2.AddString( "Event", alignment.mAcquired ? "Lanes aligned" : "Not aligned" );
+	frame_v2.AddInteger( "Dropped Symbols", alignment.mDroppedSymbols );
+	if( alignment.mAcquired )
+	{
+		// In samples, relative to lane 0
+		for( U32 lane = 1; lane < mLaneDeskew.GetLaneCount(); lane++ )
+			frame_v2.AddInteger( sLaneSkewNames[ lane ], alignment.mSkew[ lane ] );
+	}
+
+	mResults->AddFrameV2( frame_v2, "alignment", frame.mStartingSampleInclusive, frame.mEndingSampleInclusive );
+	mResults->AddFrame( frame );
+	CommitFrame( frame.mEndingSampleInclusive );
+}
+
+void decode8b10bAnalyzer::AddSyncFrame( const decode8b10bSymbolDecoder::SyncEvent& sync )
+{
+	bool lost_by_errors = ( sync.mCause == decode8b10bSymbolDecoder::LossByErrors );
+
+	// One frame covers the whole stretch spent without symbol lock
+	Frame frame;
+	frame.mData1 = sync.mHuntedBits;
+	frame.mData2 = sync.mCause;
+	frame.mType = decode8b10bAnalyzerResults::SyncFrame;
+	frame.mFlags = lost_by_errors ? DISPLAY_AS_WARNING_FLAG : 0;
+	if( !sync.mAcquired )
+		frame.mFlags |= decode8b10bAnalyzerResults::SyncNotAcquiredFlag;
+	frame.mStartingSampleInclusive = sync.mUnlockedSince;
+	frame.mEndingSampleInclusive = std::max( sync.mUnlockedSince, sync.mLockedAt );
+
+	FrameV2 frame_v2;
+	frame_v2.AddString( "Event", sync.mAcquired ? "Lock acquired" : "No lock" );
+	frame_v2.AddString( "Cause", lost_by_errors ? "Code errors" : "Start of capture" );
+	frame_v2.AddInteger( "Hunted Bits", sync.mHuntedBits );
+
+	mResults->AddFrameV2( frame_v2, "sync", frame.mStartingSampleInclusive, frame.mEndingSampleInclusive );
+	mResults->AddFrame( frame );
+	CommitFrame( frame.mEndingSampleInclusive );
+}
+
+void decode8b10bAnalyzer::AddBitRateFrame( const decode8b10bBitRateDetector::Estimate& estimate, U64 start, U64 end )
+{
+	// Covers the line before the first edge, ahead of everything the decoder reports
+	Frame frame;
+	frame.mData1 = estimate.mDetected ? estimate.mBitRate : mSettings.mBitRate;
+	frame.mData2 = estimate.mFittedRuns;
+	frame.mType = decode8b10bAnalyzerResults::BitRateFrame;
+	frame.mFlags = estimate.mDetected ? 0 : ( decode8b10bAnalyzerResults::BitRateNotDetectedFlag | DISPLAY_AS_WARNING_FLAG );
+	frame.mStartingSampleInclusive = start;
+	frame.mEndingSampleInclusive = end;
+
+	FrameV2 frame_v2;
+	frame_v2.AddBoolean( "Detected", estimate.mDetected );
+	frame_v2.AddInteger( "Bit Rate", frame.mData1 );
+	frame_v2.AddInteger( "Runs", estimate.mRuns );
+	frame_v2.AddInteger( "Fitted Runs", estimate.mFittedRuns );
+
+	mResults->AddFrameV2( frame_v2, "bit_rate", frame.mStartingSampleInclusive, frame.mEndingSampleInclusive );
+	mResults->AddFrame( frame );
+	CommitFrame( frame.mEndingSampleInclusive );
+}
+
+void decode8b10bAnalyzer::ExtendIdleRun( U64 start, U64 end, U32 ordered_sets, U32 symbols )
+{
+	if( mIdleRunSymbols == 0 )
+		mIdleRunStart = start;
+	mIdleRunEnd = end;
+	mIdleRunSymbols += symbols;
+	mIdleRunOrderedSets += ordered_sets;
+
+	// A live link sending nothing but idle would otherwise show nothing until the capture stops
+	if( LatencyReached() )
+	{
+		FlushIdleRun();
+		FlushFrames();
+	}
+}
+
+void decode8b10bAnalyzer::FlushIdleRun()
+{
+	if( mIdleRunSymbols == 0 )
+		return;
+
+	Frame frame;
+	frame.mData1 = mIdleRunOrderedSets;
+	frame.mData2 = mIdleRunSymbols;
+	frame.mType = decode8b10bAnalyzerResults::IdleFrame;
+	frame.mFlags = 0;
+	frame.mStartingSampleInclusive = mIdleRunStart;
+	frame.mEndingSampleInclusive = mIdleRunEnd;
+
+	FrameV2 frame_v2;
+	frame_v2.AddInteger( "Ordered Sets", mIdleRunOrderedSets );
+	frame_v2.AddInteger( "Symbols", mIdleRunSymbols );
+
+	mResults->AddFrameV2( frame_v2, "idle", frame.mStartingSampleInclusive, frame.mEndingSampleInclusive );
+	mResults->AddFrame( frame );
+	CommitFrame( frame.mEndingSampleInclusive );
+
+	mIdleRunSymbols = 0;
+	mIdleRunOrderedSets = 0;
+}
+
+void decode8b10bAnalyzer::CommitFrame( U64 end_sample )
+{
+	mUncommittedFrames++;
+	mLastFrameSample = end_sample;
+
+	bool span_reached = mSettings.mCommitSpanSamples != 0 && end_sample - mLastCommitSample >= mSettings.mCommitSpanSamples;
+	if( mUncommittedFrames >= mCommitBatchFrames || span_reached || LatencyReached() )
+		FlushFrames();
+}
+
+void decode8b10bAnalyzer::FlushFrames()
+{
+	if( mUncommittedFrames == 0 )
+		return;
+
+	mResults->CommitResults();
+	ReportProgress( mLastFrameSample );
+	mLastCommitSample = mLastFrameSample;
+	mLastCommitTime = std::chrono::steady_clock::now();
+	mUncommittedFrames = 0;
+
+	// Batches start at one frame and double up to the configured size, so the first frames show up right away
+	mCommitBatchFrames = std::min<U32>( mCommitBatchFrames * 2, mSettings.mCommitBatchFrames );
+}
+
+bool decode8b10bAnalyzer::LatencyReached()
+{
+	// The clock is only read every 64 calls, a small fraction of the time the frames take to decode
+	if( mSettings.mLiveLatencyMs == 0 || ( ++mLatencyChecks & 63 ) != 0 )
+		return false;
+	return std::chrono::steady_clock::now() - mLastCommitTime >= mLiveLatency;
 }
 
 bool decode8b10bAnalyzer::NeedsRerun()
@@ -280,7 +609,12 @@ U32 decode8b10bAnalyzer::GenerateSimulationData( U64 minimum_sample_index, U32 d
 
 U32 decode8b10bAnalyzer::GetMinimumSampleRateHz()
 {
-	return mSettings.mBitRate * 4;
+	// Bit timing is fractional, so the sample rate need not be a whole multiple of the bit rate. Clock recovery
+	// also averages the bit period over many edges and decodes down to 2.5x the bit rate.
+	U64 minimum_rate = U64( mSettings.mBitRate ) * 3;
+	if( mSettings.mSamplingMode == decode8b10bAnalyzerSettings::ClockRecoverySampling )
+		minimum_rate = U64( mSettings.mBitRate ) * 5 / 2;
+	return U32( std::min<U64>( minimum_rate, 0xFFFFFFFF ) );
 }
 
 const char* decode8b10bAnalyzer::GetAnalyzerName() const
@@ -5,9 +5,17 @@
 #include "decode8b10bAnalyzerSettings.h"
 #include "decode8b10bAnalyzerResults.h"
 #include "decode8b10bSimulationDataGenerator.h"
+#include "decode8b10bOrderedSetDecoder.h"
+#include "decode8b10bSymbolDecoder.h"
+#include "decode8b10bBitRateDetector.h"
+#include "decode8b10bLaneDeskew.h"
+#include "decode8b10bDecodePipeline.h"
+#include <chrono>
 #include <memory>
+#include <vector>
 
-class ANALYZER_EXPORT decode8b10bAnalyzer : public Analyzer2
+class ANALYZER_EXPORT decode8b10bAnalyzer : public Analyzer2, private decode8b10bSymbolDecoder::Listener, private decode8b10bOrderedSetDecoder::Listener,
+											 private decode8b10bLaneDeskew::Listener, private decode8b10bDecodePipeline::Listener
 {
 public:
 	decode8b10bAnalyzer();
@@ -23,7 +31,26 @@ public:
 	virtual bool NeedsRerun();
 
 private:
-	U8 CountOnes(U16 value);
+	virtual void OnSymbolDecoded( const decode8b10bSymbolDecoder::Symbol& record );
+	virtual void OnSyncEvent( const decode8b10bSymbolDecoder::SyncEvent& sync );
+	virtual void OnSyncLost( U64 sample );
+	virtual void OnSymbol( const decode8b10bOrderedSetDecoder::Symbol& record );
+	virtual void OnOrderedSet( const decode8b10bOrderedSetDecoder::OrderedSet& ordered_set );
+	virtual void OnPacket( const decode8b10bOrderedSetDecoder::Packet& packet );
+	virtual void OnColumn( const decode8b10bLaneDeskew::Column& column );
+	virtual void OnAlignment( const decode8b10bLaneDeskew::Alignment& alignment );
+	virtual void OnLaneEvent( U32 lane, const decode8b10bLaneQueue::Event& event );
+	template <class Source>
+	void Decode( Source& source, U32 bit_rate );
+	template <class Core>
+	void RecoverBits( Core& core );
+	void AddSyncFrame( const decode8b10bSymbolDecoder::SyncEvent& sync );
+	void AddBitRateFrame( const decode8b10bBitRateDetector::Estimate& estimate, U64 start, U64 end );
+	void ExtendIdleRun( U64 start, U64 end, U32 ordered_sets, U32 symbols );
+	void FlushIdleRun();
+	void CommitFrame( U64 end_sample );
+	void FlushFrames();
+	bool LatencyReached();
 
 protected: //vars
 	decode8b10bAnalyzerSettings mSettings;
@@ -34,9 +61,39 @@ protected: //vars
 	bool mSimulationInitialized;
 
 	//Serial analysis vars:
-	U32 mSampleRateHz;
+	U64 mSampleRateHz;
 	U32 mStartOfStopBitOffset;
 	U32 mEndOfStopBitOffset;
+	U64 mBitPeriod; // samples per bit, 32.32 fixed point
+
+	bool mLastWasK28_5;
+
+	static const char* const sDisparityNames[ 3 ];
+	static const S64 sCompactDisparity[ 3 ];
+	static const char* const sLaneNames[ decode8b10bLaneDeskew::MaxLanes ];
+	static const char* const sLaneSkewNames[ decode8b10bLaneDeskew::MaxLanes ];
+
+	//idle run merging:
+	U64 mIdleRunStart;
+	U64 mIdleRunEnd;
+	U64 mIdleRunSymbols;
+	U64 mIdleRunOrderedSets;
+
+	decode8b10bOrderedSetDecoder mOrderedSetDecoder;
+	decode8b10bLaneDeskew mLaneDeskew;
+	U32 mLaneCount;
+	U64 mLaneEndSample; // latest symbol end across the lanes
+
+	//result commit batching:
+	U32 mUncommittedFrames;
+	U32 mCommitBatchFrames;
+	U64 mLastFrameSample;
+	U64 mLastCommitSample;
+
+	//live decoding, when mSettings.mLiveLatencyMs is set:
+	std::chrono::steady_clock::duration mLiveLatency;
+	std::chrono::steady_clock::time_point mLastCommitTime;
+	U32 mLatencyChecks;
 };
 
 extern "C" ANALYZER_EXPORT const char* __cdecl GetAnalyzerName();
@@ -3,14 +3,27 @@
 #include "decode8b10bAnalyzer.h"
 #include "decode8b10bAnalyzerSettings.h"
 #include "decode8b10bSymbolUtils.h"
+#include "decode8b10bOrderedSetDecoder.h"
+#include "decode8b10bSymbolDecoder.h"
 #include <iostream>
 #include <fstream>
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstring>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
 
 decode8b10bAnalyzerResults::decode8b10bAnalyzerResults( decode8b10bAnalyzer* analyzer, decode8b10bAnalyzerSettings* settings )
 :	AnalyzerResults(),
 	mSettings( settings ),
 	mAnalyzer( analyzer )
 {
+	// Built up front, as the SDK may ask for bubbles while the worker is still adding frames
+	for( U32 display_base = 0; display_base < NumDisplayBases; display_base++ )
+		BuildSymbolBubbleText( DisplayBase( display_base ) );
 }
 
 decode8b10bAnalyzerResults::~decode8b10bAnalyzerResults()
@@ -22,112 +35,454 @@ void decode8b10bAnalyzerResults::GenerateBubbleText( U64 frame_index, Channel& c
 	ClearResultStrings();
 	Frame frame = GetFrame( frame_index );
 
-	if( frame.mType == 1 || frame.mType == 0)
+	if( frame.mType == ControlFrame || frame.mType == DataFrame || frame.mType == ErrorFrame )
 	{
-		// Use shared utility for symbol naming
-		U16 ten_bit_pattern = frame.mData2;
-		
-		auto decode_result = decode8b10bSymbolUtils::DecodeSymbol(ten_bit_pattern);
-		U16 decoded_value = std::get<0>(decode_result);
-		decode8b10bSymbolUtils::Disparity disparity = std::get<1>(decode_result);
-		bool is_valid = std::get<2>(decode_result);
-
-		const char* symbol_name = decode8b10bSymbolUtils::GetSymbolName(decoded_value);
-
-		char disp_str[32];
-		if( disparity == decode8b10bSymbolUtils::Disparity::Positive )
+		// Symbol bubbles only depend on the 10-bit code, so they come straight from the per-base table
+		const SymbolBubbleText& text = GetSymbolBubbleText( U16( frame.mData2 ), display_base );
+		AddResultString( text.mShort.c_str() );
+		AddResultString( text.mLong.c_str() );
+		if( frame.mType == ErrorFrame )
+			AddResultString( text.mLong.c_str() );
+	}
+	else if( frame.mType == SyncFrame )
+	{
+		const char* event_str = "Lock acquired";
+		if( frame.mFlags & SyncNotAcquiredFlag )
+			event_str = "No lock";
+		else if( frame.mFlags & DISPLAY_AS_WARNING_FLAG )
+			event_str = "Relocked";
+
+		char sync_str[128];
+		snprintf( sync_str, sizeof(sync_str), "%s after %llu bits", event_str, (unsigned long long)frame.mData1 );
+
+		AddResultString( "SYNC" );
+		AddResultString( sync_str );
+	}
+	else if( frame.mType == IdleFrame )
+	{
+		char idle_str[64];
+		snprintf( idle_str, sizeof(idle_str), "Idle x%llu", (unsigned long long)frame.mData1 );
+
+		AddResultString( "IDLE" );
+		AddResultString( idle_str );
+	}
+	else if( frame.mType == OrderedSetFrame )
+	{
+		const char* name = decode8b10bOrderedSetDecoder::GetOrderedSetName( decode8b10bOrderedSetDecoder::OrderedSetType( frame.mData1 ) );
+		AddResultString( name );
+
+		if( frame.mData1 == decode8b10bOrderedSetDecoder::ConfigSet1 || frame.mData1 == decode8b10bOrderedSetDecoder::ConfigSet2 )
 		{
-			sprintf( disp_str, " RD+" );
+			char number_str[128];
+			AnalyzerHelpers::GetNumberString( frame.mData2, display_base, 16, number_str, 128 );
+			char config_str[160];
+			snprintf( config_str, sizeof(config_str), "%s config %s", name, number_str );
+			AddResultString( config_str );
 		}
-		else if( disparity == decode8b10bSymbolUtils::Disparity::Negative )
+	}
+	else if( frame.mType == PacketFrame )
+	{
+		char packet_str[128];
+		GetPacketDescription( frame, packet_str, sizeof(packet_str) );
+
+		AddResultString( "PKT" );
+		AddResultString( packet_str );
+	}
+	else if( frame.mType == BitRateFrame )
+	{
+		char rate_str[128];
+		GetBitRateDescription( frame, rate_str, sizeof(rate_str) );
+
+		AddResultString( "RATE" );
+		AddResultString( rate_str );
+	}
+	else if( frame.mType == ColumnFrame )
+	{
+		// The lanes' symbol bubbles side by side
+		std::string short_str;
+		std::string long_str;
+		U32 lane_count = GetColumnLaneCount( frame );
+		for( U32 lane = 0; lane < lane_count; lane++ )
 		{
-			sprintf( disp_str, " RD-" );
+			const SymbolBubbleText& text = GetSymbolBubbleText( U16( ( frame.mData2 >> ( ColumnLaneBits * lane ) ) & ColumnCodeMask ), display_base );
+			if( lane > 0 )
+			{
+				short_str += " ";
+				long_str += " | ";
+			}
+			short_str += text.mShort;
+			long_str += text.mLong;
 		}
-		else
+		if( frame.mFlags & ColumnAlignmentErrorFlag )
+			long_str += ", alignment error";
+
+		AddResultString( short_str.c_str() );
+		AddResultString( long_str.c_str() );
+	}
+	else if( frame.mType == AlignmentFrame )
+	{
+		char alignment_str[128];
+		GetAlignmentDescription( frame, alignment_str, sizeof(alignment_str) );
+
+		AddResultString( "ALIGN" );
+		AddResultString( alignment_str );
+	}
+}
+
+const decode8b10bAnalyzerResults::SymbolBubbleText& decode8b10bAnalyzerResults::GetSymbolBubbleText( U16 ten_bit_code, DisplayBase display_base ) const
+{
+	return mSymbolBubbleText[ U32( display_base ) % NumDisplayBases ][ ten_bit_code & 0x3FF ];
+}
+
+void decode8b10bAnalyzerResults::BuildSymbolBubbleText( DisplayBase display_base )
+{
+	// One entry per 10-bit pattern, formatted exactly once
+	std::vector<SymbolBubbleText>& table = mSymbolBubbleText[ U32( display_base ) ];
+	table.resize( 1024 );
+	for( U16 code = 0; code < 1024; code++ )
+	{
+		const decode8b10bSymbolUtils::SymbolInfo& symbol = decode8b10bSymbolUtils::LookupSymbol( code );
+		SymbolBubbleText& text = table[ code ];
+
+		if( !decode8b10bSymbolUtils::IsValid( symbol ) )
 		{
-			sprintf( disp_str, " RD+/-" );
+			// Invalid symbol - show the 10-bit pattern in hex for analysis
+			char error_str[32];
+			snprintf( error_str, sizeof(error_str), "UNK:0x%03X", code );
+			text.mShort = "UNK";
+			text.mLong = error_str;
+			continue;
 		}
 
-		char number_str[128];
-		AnalyzerHelpers::GetNumberString( frame.mData1, display_base, 8, number_str, 128 );
+		static const char* const disparity_names[] = { " RD-", " RD+", " RD+/-" };
+		const char* symbol_name = decode8b10bSymbolUtils::GetSymbolName( symbol );
+
 		char long_str[128];
-		sprintf( long_str, "%s%s", symbol_name, disp_str );       // Medium format (default)
+		snprintf( long_str, sizeof(long_str), "%s%s", symbol_name, disparity_names[ int( decode8b10bSymbolUtils::GetDisparity( symbol ) ) ] );
 
-		// Multi-level display with correct RD
-		if( frame.mType == 0) {
-			AddResultString( number_str );
-			char data_str[512];
-			snprintf( data_str, sizeof(data_str), "%s (%s)", number_str, long_str); 
-			AddResultString( data_str );
+		if( decode8b10bSymbolUtils::IsControl( symbol ) )
+		{
+			text.mShort = symbol_name;
+			text.mLong = long_str;
 		}
-		else {
-			AddResultString( symbol_name );                                           // Short format
-			AddResultString( long_str );
+		else
+		{
+			char number_str[128];
+			AnalyzerHelpers::GetNumberString( symbol.mDecoded, display_base, 8, number_str, 128 );
+			char data_str[512];
+			snprintf( data_str, sizeof(data_str), "%s (%s)", number_str, long_str );
+			text.mShort = number_str;
+			text.mLong = data_str;
 		}
-		
-		
-	}
-	else
-	{
-		// Invalid symbol - show the 10-bit pattern in hex for analysis
-		char hex_str[32];
-		sprintf( hex_str, "0x%03llX", (unsigned long long)(frame.mData2 & 0x3FF) );
-		char error_str[64];
-		sprintf( error_str, "UNK:%s", hex_str );
-		
-		AddResultString( "UNK" );
-		AddResultString( error_str );
-		AddResultString( error_str );
 	}
 }
 
+
 void decode8b10bAnalyzerResults::GenerateExportFile( const char* file, DisplayBase display_base, U32 export_type_user_id )
+{
+	if( export_type_user_id == BinaryExport )
+		GenerateBinaryExport( file );
+	else
+		GenerateCsvExport( file, display_base );
+}
+
+void decode8b10bAnalyzerResults::GenerateCsvExport( const char* file, DisplayBase display_base )
 {
 	std::ofstream file_stream( file, std::ios::out );
 
 	U64 trigger_sample = mAnalyzer->GetTriggerSample();
-	U32 sample_rate = mAnalyzer->GetSampleRate();
+	U64 sample_rate = mAnalyzer->GetSampleRate();
 
-	file_stream << "Time [s],Symbol,Type,Value,10-bit Code,5b/6b,3b/4b" << std::endl;
+	file_stream << "Time [s],Symbol,Type,Value,10-bit Code,5b/6b,3b/4b,Error\n";
 
+	// Frames are read here a chunk at a time into a window of slots, formatted into per-chunk text by a fixed set of
+	// workers that take the chunks in turn, then written here in order. This thread formats chunks too while it waits,
+	// so on a single core no worker is started. Only the formatting runs in parallel; the results object is only
+	// touched from this thread, which also reports progress and checks for cancel once per chunk.
 	U64 num_frames = GetNumFrames();
-	for( U32 i=0; i < num_frames; i++ )
+	U64 num_chunks = ( num_frames + CsvExportChunkFrames - 1 ) / CsvExportChunkFrames;
+	U32 num_threads = std::max<U32>( 1, std::min<U32>( std::thread::hardware_concurrency(), CsvExportMaxWorkers ) );
+	U32 num_workers = U32( std::min<U64>( num_threads - 1, num_chunks ) );
+	U32 num_slots = 2 * num_threads;
+
+	struct Chunk
 	{
-		Frame frame = GetFrame( i );
-		
-		char time_str[128];
-		AnalyzerHelpers::GetTimeString( frame.mStartingSampleInclusive, trigger_sample, sample_rate, time_str, 128 );
+		std::vector<Frame> mFrames;
+		std::string mText;
+		bool mFormatted;
+	};
+	std::vector<Chunk> slots( num_slots );
+	std::atomic<U64> next_chunk( 0 );
+	U64 loaded_chunks = 0; // written under the mutex, by this thread only
+	bool cancelled = false;
+	std::mutex mutex;
+	std::condition_variable condition;
+
+	auto format_chunk = [&]( U64 chunk ) {
+		Chunk& slot = slots[ chunk % num_slots ];
+		slot.mText.clear();
+		for( const Frame& frame : slot.mFrames )
+			FormatCsvRow( frame, trigger_sample, sample_rate, display_base, slot.mText );
+
+		std::lock_guard<std::mutex> lock( mutex );
+		slot.mFormatted = true;
+		condition.notify_all();
+	};
+
+	auto format_chunks = [&]() {
+		for( ; ; )
+		{
+			U64 chunk = next_chunk.fetch_add( 1 );
+			if( chunk >= num_chunks )
+				return;
+
+			{
+				std::unique_lock<std::mutex> lock( mutex );
+				condition.wait( lock, [&]() { return loaded_chunks > chunk || cancelled; } );
+				if( cancelled )
+					return;
+			}
+			format_chunk( chunk );
+		}
+	};
+
+	std::vector<std::thread> workers;
+	for( U32 i = 0; i < num_workers; i++ )
+		workers.push_back( std::thread( format_chunks ) );
+
+	for( U64 written = 0; written < num_chunks; written++ )
+	{
+		// Keep the window full, so the workers have the next chunks while this one is written
+		while( loaded_chunks < num_chunks && loaded_chunks < written + num_slots )
+		{
+			Chunk& slot = slots[ loaded_chunks % num_slots ];
+			U64 first_frame = loaded_chunks * CsvExportChunkFrames;
+			U64 chunk_end = std::min<U64>( first_frame + CsvExportChunkFrames, num_frames );
+			slot.mFrames.clear();
+			for( U64 i = first_frame; i < chunk_end; i++ )
+				slot.mFrames.push_back( GetFrame( i ) );
+
+			std::lock_guard<std::mutex> lock( mutex );
+			slot.mFormatted = false;
+			loaded_chunks++;
+			condition.notify_all();
+		}
+
+		// Chunks already loaded that no worker has taken yet are formatted here rather than waited for
+		for( ; ; )
+		{
+			U64 chunk = next_chunk.load();
+			if( chunk >= loaded_chunks || !next_chunk.compare_exchange_strong( chunk, chunk + 1 ) )
+				break;
+			format_chunk( chunk );
+		}
+
+		Chunk& slot = slots[ written % num_slots ];
+		{
+			std::unique_lock<std::mutex> lock( mutex );
+			condition.wait( lock, [&]() { return slot.mFormatted; } );
+		}
+		file_stream.write( slot.mText.data(), slot.mText.size() );
+
+		if( UpdateExportProgressAndCheckForCancel( std::min<U64>( ( written + 1 ) * CsvExportChunkFrames, num_frames ), num_frames ) == true )
+		{
+			std::lock_guard<std::mutex> lock( mutex );
+			cancelled = true;
+			condition.notify_all();
+			break;
+		}
+	}
+
+	for( std::thread& worker : workers )
+		worker.join();
+
+	file_stream.close();
+}
 
-		char number_str[128];
-		AnalyzerHelpers::GetNumberString( frame.mData1, display_base, 8, number_str, 128 );
+void decode8b10bAnalyzerResults::FormatCsvRow( const Frame& frame, U64 trigger_sample, U64 sample_rate, DisplayBase display_base, std::string& text )
+{
+	// The SDK hands out the sample rate as a U32 and formats times from one, so narrowing it back loses nothing.
+	// Only the bit timing needs the U64, for the rate scaled to 32.32 fixed point.
+	char time_str[128];
+	AnalyzerHelpers::GetTimeString( frame.mStartingSampleInclusive, trigger_sample, U32( sample_rate ), time_str, 128 );
+
+	char number_str[128];
+	AnalyzerHelpers::GetNumberString( frame.mData1, display_base, 8, number_str, 128 );
 
-		if( frame.mFlags == 1 && frame.mData1 == 0xBC )
+	char row_str[512];
+	if( frame.mType == ColumnFrame )
+	{
+		// Lanes side by side in the symbol and value columns, the first error in the error column
+		std::string names_str;
+		std::string values_str;
+		char lane_error_str[64] = "";
+		if( frame.mFlags & ColumnAlignmentErrorFlag )
+			snprintf( lane_error_str, sizeof(lane_error_str), "Alignment error" );
+
+		U32 lane_count = GetColumnLaneCount( frame );
+		for( U32 lane = 0; lane < lane_count; lane++ )
 		{
-			// K28.5 with correct RD and 10-bit breakdown
-			U16 ten_bit_pattern = frame.mData2;
-			bool is_rd_minus = (ten_bit_pattern == 0xFA);
-			
-			if( is_rd_minus )
+			U16 lane_bits = U16( frame.mData2 >> ( ColumnLaneBits * lane ) );
+			const decode8b10bSymbolUtils::SymbolInfo& symbol = decode8b10bSymbolUtils::LookupSymbol( lane_bits & ColumnCodeMask );
+			AnalyzerHelpers::GetNumberString( ( frame.mData1 >> ( ColumnLaneBits * lane ) ) & 0xFF, display_base, 8, number_str, 128 );
+			if( lane > 0 )
 			{
-				file_stream << time_str << ",K28.5 RD-,Control," << number_str << ",0011111010,001111,1010" << std::endl;
+				names_str += " ";
+				values_str += " ";
 			}
-			else
+			names_str += decode8b10bSymbolUtils::GetSymbolName( symbol );
+			values_str += number_str;
+
+			decode8b10bSymbolDecoder::SymbolError error = decode8b10bSymbolDecoder::SymbolError( ( lane_bits & ColumnErrorMask ) >> ColumnErrorShift );
+			if( error != decode8b10bSymbolDecoder::NoSymbolError && lane_error_str[ 0 ] == 0 )
+				snprintf( lane_error_str, sizeof(lane_error_str), "Lane %u: %s", lane, decode8b10bSymbolDecoder::GetSymbolErrorText( error ) );
+		}
+
+		snprintf( row_str, sizeof(row_str), "%s,%s,Column,%s,,,,%s\n", time_str, names_str.c_str(), values_str.c_str(), lane_error_str );
+	}
+	else if( frame.mType == DataFrame || frame.mType == ControlFrame || frame.mType == ErrorFrame )
+	{
+		// Every symbol gets its name, RD column and 10-bit breakdown (abcdei fghj)
+		U16 ten_bit_pattern = U16( frame.mData2 & 0x3FF );
+		const decode8b10bSymbolUtils::SymbolInfo& symbol = decode8b10bSymbolUtils::LookupSymbol( ten_bit_pattern );
+
+		static const char* const rd_names[] = { " RD-", " RD+", " RD+/-" };
+		static const char* const type_names[] = { "Data", "Control", "Error" };
+		const char* rd_str = decode8b10bSymbolUtils::IsValid( symbol ) ? rd_names[ int( decode8b10bSymbolUtils::GetDisparity( symbol ) ) ] : "";
+
+		char code_str[11];
+		for( int bit = 0; bit < 10; bit++ )
+			code_str[ bit ] = ( ten_bit_pattern & ( 0x200 >> bit ) ) ? '1' : '0';
+		code_str[ 10 ] = 0;
+
+		decode8b10bSymbolDecoder::SymbolError error = decode8b10bSymbolDecoder::SymbolError( ( frame.mFlags & SymbolErrorMask ) >> SymbolErrorShift );
+
+		snprintf( row_str, sizeof(row_str), "%s,%s%s,%s,%s,%s,%.6s,%s,%s\n", time_str, decode8b10bSymbolUtils::GetSymbolName( symbol ), rd_str,
+				  type_names[ frame.mType ], number_str, code_str, code_str, code_str + 6, decode8b10bSymbolDecoder::GetSymbolErrorText( error ) );
+	}
+	else
+	{
+		char description_str[160] = "";
+		if( frame.mType == SyncFrame )
+			snprintf( description_str, sizeof(description_str), "Sync: %llu bits hunted", (unsigned long long)frame.mData1 );
+		else if( frame.mType == IdleFrame )
+			snprintf( description_str, sizeof(description_str), "Idle x%llu", (unsigned long long)frame.mData1 );
+		else if( frame.mType == OrderedSetFrame )
+			snprintf( description_str, sizeof(description_str), "%s", decode8b10bOrderedSetDecoder::GetOrderedSetName( decode8b10bOrderedSetDecoder::OrderedSetType( frame.mData1 ) ) );
+		else if( frame.mType == PacketFrame )
+			GetPacketDescription( frame, description_str, sizeof(description_str) );
+		else if( frame.mType == BitRateFrame )
+			GetBitRateDescription( frame, description_str, sizeof(description_str) );
+		else if( frame.mType == AlignmentFrame )
+			GetAlignmentDescription( frame, description_str, sizeof(description_str) );
+
+		static const char* const type_names[] = { "Sync", "Idle", "Ordered Set", "Packet", "Bit Rate", "Column", "Alignment" };
+		const char* type_str = ( frame.mType >= SyncFrame && frame.mType <= AlignmentFrame ) ? type_names[ frame.mType - SyncFrame ] : "";
+
+		snprintf( row_str, sizeof(row_str), "%s,%s,%s,%s,,,,\n", time_str, description_str, type_str, number_str );
+	}
+
+	text += row_str;
+}
+
+// Layout of GenerateBinaryExport's output, all fields little-endian:
+//   header, 40 bytes: "8B10BSYM", U32 version (1), U32 record size (32), U64 sample rate, U64 trigger sample, U64 record count
+//   record, 32 bytes: U64 start sample, U64 end sample,
+//                     U32 value (decoded value for symbols, Frame::mData1 otherwise),
+//                     U16 code (10-bit code for symbols, config word for ordered sets, runs fitted for the bit rate),
+//                     U8 frame type, U8 frame flags, S8 disparity of the code (-1, 0, +1), U8 SymbolError, 6 bytes zero
+// Column records hold one octet per lane in value, lane 0 in the low byte, and in code a bit per lane from bit 0 for
+// K-characters and from bit 4 for symbol errors.
+enum
+{
+	BinaryExportVersion = 1,
+	BinaryHeaderSize = 40,
+	BinaryRecordSize = 32,
+	BinaryWriteBufferSize = 1 << 20
+};
+
+static U8* PutLittleEndian( U8* out, U64 value, int num_bytes )
+{
+	for( int i = 0; i < num_bytes; i++ )
+		out[ i ] = U8( value >> ( 8 * i ) );
+	return out + num_bytes;
+}
+
+void decode8b10bAnalyzerResults::GenerateBinaryExport( const char* file )
+{
+	std::ofstream file_stream( file, std::ios::out | std::ios::binary );
+
+	U64 num_frames = GetNumFrames();
+
+	// Records are staged in a large buffer so the stream sees a few big writes instead of one per frame
+	std::vector<U8> buffer( BinaryWriteBufferSize );
+	U8* out = &buffer[ 0 ];
+
+	memcpy( out, "8B10BSYM", 8 );
+	out = PutLittleEndian( out + 8, BinaryExportVersion, 4 );
+	out = PutLittleEndian( out, BinaryRecordSize, 4 );
+	out = PutLittleEndian( out, mAnalyzer->GetSampleRate(), 8 );
+	out = PutLittleEndian( out, mAnalyzer->GetTriggerSample(), 8 );
+	out = PutLittleEndian( out, num_frames, 8 );
+
+	for( U64 i=0; i < num_frames; i++ )
+	{
+		Frame frame = GetFrame( i );
+
+		bool is_symbol = ( frame.mType == DataFrame || frame.mType == ControlFrame || frame.mType == ErrorFrame );
+		S8 disparity = 0;
+		U8 error = 0;
+		if( frame.mType == ColumnFrame )
+		{
+			U64 octets = 0;
+			U64 lane_flags = 0;
+			for( U32 lane = 0, lane_count = GetColumnLaneCount( frame ); lane < lane_count; lane++ )
 			{
-				file_stream << time_str << ",K28.5 RD+,Control," << number_str << ",1100000101,110000,0101" << std::endl;
+				U64 decoded = frame.mData1 >> ( ColumnLaneBits * lane );
+				octets |= ( decoded & 0xFF ) << ( 8 * lane );
+				lane_flags |= ( ( decoded >> 8 ) & 1 ) << lane;
+				if( ( frame.mData2 >> ( ColumnLaneBits * lane ) ) & ColumnErrorMask )
+					lane_flags |= 0x10 << lane;
 			}
+			frame.mData1 = octets;
+			frame.mData2 = lane_flags;
 		}
-		else
+		else if( is_symbol )
+		{
+			static const S8 disparity_values[] = { -1, 1, 0 };
+			const decode8b10bSymbolUtils::SymbolInfo& symbol = decode8b10bSymbolUtils::LookupSymbol( U16( frame.mData2 ) );
+			if( decode8b10bSymbolUtils::IsValid( symbol ) )
+				disparity = disparity_values[ int( decode8b10bSymbolUtils::GetDisparity( symbol ) ) ];
+			error = ( frame.mFlags & SymbolErrorMask ) >> SymbolErrorShift;
+		}
+
+		U8* record = out;
+		out = PutLittleEndian( out, frame.mStartingSampleInclusive, 8 );
+		out = PutLittleEndian( out, frame.mEndingSampleInclusive, 8 );
+		out = PutLittleEndian( out, std::min<U64>( frame.mData1, 0xFFFFFFFF ), 4 );
+		out = PutLittleEndian( out, frame.mData2, 2 );
+		*out++ = frame.mType;
+		*out++ = frame.mFlags;
+		*out++ = U8( disparity );
+		*out++ = error;
+		memset( out, 0, record + BinaryRecordSize - out );
+		out = record + BinaryRecordSize;
+
+		if( out + BinaryRecordSize > &buffer[ 0 ] + buffer.size() )
 		{
-			file_stream << time_str << ",Data,Data," << number_str << ",,,," << std::endl;
+			file_stream.write( reinterpret_cast<const char*>( &buffer[ 0 ] ), out - &buffer[ 0 ] );
+			out = &buffer[ 0 ];
 		}
 
-		if( UpdateExportProgressAndCheckForCancel( i, num_frames ) == true )
+		// Progress is reported every few thousand records to keep the per-record cost down
+		if( ( i & 0xFFF ) == 0 && UpdateExportProgressAndCheckForCancel( i, num_frames ) == true )
 		{
 			file_stream.close();
 			return;
 		}
 	}
 
+	file_stream.write( reinterpret_cast<const char*>( &buffer[ 0 ] ), out - &buffer[ 0 ] );
 	file_stream.close();
 }
 
@@ -152,8 +507,53 @@ void decode8b10bAnalyzerResults::GenerateFrameTabularText( U64 frame_index, Disp
 
 void decode8b10bAnalyzerResults::GeneratePacketTabularText( U64 packet_id, DisplayBase display_base )
 {
-	//not supported
+	// Only the 1000BASE-X layer creates packets, each holding a single PacketFrame
+	ClearTabularText();
+
+	U64 first_frame_id;
+	U64 last_frame_id;
+	GetFramesContainedInPacket( packet_id, &first_frame_id, &last_frame_id );
+	if( first_frame_id == INVALID_RESULT_INDEX )
+		return;
+
+	Frame frame = GetFrame( first_frame_id );
+	if( frame.mType != PacketFrame )
+		return;
+
+	char packet_str[128];
+	GetPacketDescription( frame, packet_str, sizeof(packet_str) );
+	AddTabularText( packet_str );
+}
 
+void decode8b10bAnalyzerResults::GetPacketDescription( const Frame& frame, char* text, U32 text_length )
+{
+	const char* crc_str = ( frame.mFlags & PacketCrcValidFlag ) ? "CRC OK" : "CRC bad";
+	const char* end_str = ( frame.mFlags & PacketTerminatedFlag ) ? "" : ", no /T/";
+	snprintf( text, text_length, "Packet %llu bytes, %s, %llu errors%s", (unsigned long long)frame.mData1, crc_str, (unsigned long long)frame.mData2, end_str );
+}
+
+void decode8b10bAnalyzerResults::GetBitRateDescription( const Frame& frame, char* text, U32 text_length )
+{
+	if( frame.mFlags & BitRateNotDetectedFlag )
+		snprintf( text, text_length, "Bit rate not detected, using %llu bits/s", (unsigned long long)frame.mData1 );
+	else
+		snprintf( text, text_length, "Detected %llu bits/s from %llu runs", (unsigned long long)frame.mData1, (unsigned long long)frame.mData2 );
+}
+
+void decode8b10bAnalyzerResults::GetAlignmentDescription( const Frame& frame, char* text, U32 text_length )
+{
+	if( frame.mFlags & AlignmentNotAcquiredFlag )
+		snprintf( text, text_length, "Lanes not aligned, %llu symbols dropped", (unsigned long long)frame.mData2 );
+	else
+		snprintf( text, text_length, "Lanes aligned, skew %llu samples, %llu symbols dropped", (unsigned long long)frame.mData1, (unsigned long long)frame.mData2 );
+}
+
+U32 decode8b10bAnalyzerResults::GetColumnLaneCount( const Frame& frame )
+{
+	U32 lane_count = 0;
+	while( lane_count < 64 / ColumnLaneBits && ( ( frame.mData2 >> ( ColumnLaneBits * lane_count ) ) & ColumnLanePresentFlag ) )
+		lane_count++;
+	return lane_count;
 }
 
 void decode8b10bAnalyzerResults::GenerateTransactionTabularText( U64 transaction_id, DisplayBase display_base )
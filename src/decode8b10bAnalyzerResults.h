@@ -2,6 +2,8 @@
 #define DECODE8B10B_ANALYZER_RESULTS
 
 #include <AnalyzerResults.h>
+#include <string>
+#include <vector>
 
 class decode8b10bAnalyzer;
 class decode8b10bAnalyzerSettings;
@@ -12,6 +14,59 @@ public:
 	decode8b10bAnalyzerResults( decode8b10bAnalyzer* analyzer, decode8b10bAnalyzerSettings* settings );
 	virtual ~decode8b10bAnalyzerResults();
 
+	// Frame::mType values
+	enum FrameType
+	{
+		DataFrame,
+		ControlFrame,
+		ErrorFrame,
+		SyncFrame,       // mData1 = bits hunted before lock, mData2 = cause of the lost lock
+		IdleFrame,       // mData1 = idle ordered sets (K28.5 count), mData2 = symbols in the run
+		OrderedSetFrame, // mData1 = decode8b10bOrderedSetDecoder::OrderedSetType, mData2 = config word
+		PacketFrame,     // mData1 = frame length after the SFD, mData2 = symbol errors inside the packet
+		BitRateFrame,    // mData1 = bit rate decoded at, mData2 = runs the detection fitted
+		ColumnFrame,     // mData1 = decoded values, mData2 = codes and errors, 16 bits per lane from lane 0 up
+		AlignmentFrame   // mData1 = samples between the earliest and latest lane, mData2 = symbols dropped lining them up
+	};
+
+	// Frame::mFlags bits on Data, Control and Error frames
+	enum
+	{
+		SymbolValidFlag = 0x01,
+		SymbolErrorShift = 1, // decode8b10bSymbolDecoder::SymbolError in bits 1-2
+		SymbolErrorMask = 0x06
+	};
+
+	// Frame::mFlags bits on a PacketFrame
+	enum
+	{
+		PacketCrcValidFlag = 0x01,
+		PacketTerminatedFlag = 0x02,
+		PacketPreambleValidFlag = 0x04
+	};
+
+	// Frame::mFlags bit on a SyncFrame that ended without finding a comma
+	enum { SyncNotAcquiredFlag = 0x01 };
+
+	// Frame::mFlags bit on a BitRateFrame when detection failed and the configured bit rate was used
+	enum { BitRateNotDetectedFlag = 0x01 };
+
+	// Each lane's 16 bits of a ColumnFrame's mData2
+	enum
+	{
+		ColumnLaneBits = 16,
+		ColumnCodeMask = 0x3FF,
+		ColumnErrorShift = 10,       // decode8b10bSymbolDecoder::SymbolError in bits 10-11
+		ColumnErrorMask = 0xC00,
+		ColumnLanePresentFlag = 0x8000
+	};
+
+	// Frame::mFlags bit on a ColumnFrame that had the alignment character on some lanes only
+	enum { ColumnAlignmentErrorFlag = 0x01 };
+
+	// Frame::mFlags bit on an AlignmentFrame that ended without the lanes lining up
+	enum { AlignmentNotAcquiredFlag = 0x01 };
+
 	virtual void GenerateBubbleText( U64 frame_index, Channel& channel, DisplayBase display_base );
 	virtual void GenerateExportFile( const char* file, DisplayBase display_base, U32 export_type_user_id );
 
@@ -19,11 +74,44 @@ public:
 	virtual void GeneratePacketTabularText( U64 packet_id, DisplayBase display_base );
 	virtual void GenerateTransactionTabularText( U64 transaction_id, DisplayBase display_base );
 
+	enum ExportType
+	{
+		CsvExport,
+		BinaryExport
+	};
+
+	enum
+	{
+		CsvExportChunkFrames = 16384, // also how often progress and cancel are checked
+		CsvExportMaxWorkers = 16
+	};
+
+	// One CSV export row, newline included, appended to text. Public for the benchmarks.
+	static void FormatCsvRow( const Frame& frame, U64 trigger_sample, U64 sample_rate, DisplayBase display_base, std::string& text );
+
+protected: //types
+	struct SymbolBubbleText
+	{
+		std::string mShort;
+		std::string mLong;
+	};
+
+	enum { NumDisplayBases = AsciiHex + 1 };
+
 protected: //functions
+	static void GetPacketDescription( const Frame& frame, char* text, U32 text_length );
+	static void GetBitRateDescription( const Frame& frame, char* text, U32 text_length );
+	static void GetAlignmentDescription( const Frame& frame, char* text, U32 text_length );
+	static U32 GetColumnLaneCount( const Frame& frame );
+	void GenerateCsvExport( const char* file, DisplayBase display_base );
+	void GenerateBinaryExport( const char* file );
+	const SymbolBubbleText& GetSymbolBubbleText( U16 ten_bit_code, DisplayBase display_base ) const;
+	void BuildSymbolBubbleText( DisplayBase display_base );
 
 protected:  //vars
 	decode8b10bAnalyzerSettings* mSettings;
 	decode8b10bAnalyzer* mAnalyzer;
+	std::vector<SymbolBubbleText> mSymbolBubbleText[ NumDisplayBases ]; // indexed by 10-bit code
 };
 
 #endif //DECODE8B10B_ANALYZER_RESULTS
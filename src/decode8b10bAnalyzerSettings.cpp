@@ -5,32 +5,169 @@
 decode8b10bAnalyzerSettings::decode8b10bAnalyzerSettings()
 :	mInputChannel( UNDEFINED_CHANNEL ),
 	mBitRate( 9600 ),
-	mDropIdleFrames( false ),
+	mDetectBitRate( false ),
+	mIdleMode( ShowIdle ),
+	mProtocolLayer( SymbolLayer ),
+	mSamplingMode( PerBitSampling ),
+	mBitOrder( LsbFirst ),
+	mFrameV2Schema( FullFrameV2 ),
+	mCommitBatchFrames( 4096 ),
+	mCommitSpanSamples( 10000000 ),
+	mLossOfSyncErrors( 4 ),
+	mLossOfSyncWindow( 16 ),
+	mSimulationTraffic( PacketTraffic ),
+	mSimulationErrorInterval( 0 ),
+	mPllGainShift( 5 ),
+	mAlignmentCharacter( AlignOnK28_3 ),
+	mLiveLatencyMs( 0 ),
 	mInputChannelInterface(),
 	mBitRateInterface(),
-	mDropIdleFramesInterface()
+	mDetectBitRateInterface(),
+	mIdleModeInterface(),
+	mProtocolLayerInterface(),
+	mSamplingModeInterface(),
+	mBitOrderInterface(),
+	mFrameV2SchemaInterface(),
+	mCommitBatchFramesInterface(),
+	mCommitSpanSamplesInterface(),
+	mLossOfSyncErrorsInterface(),
+	mLossOfSyncWindowInterface(),
+	mSimulationTrafficInterface(),
+	mSimulationErrorIntervalInterface(),
+	mPllGainShiftInterface(),
+	mAlignmentCharacterInterface(),
+	mLiveLatencyMsInterface()
 {
 	mInputChannelInterface.SetTitleAndTooltip( "Serial", "Standard 8b10b Decoder" );
 	mInputChannelInterface.SetChannel( mInputChannel );
 
 	mBitRateInterface.SetTitleAndTooltip( "Bit Rate (Bits/S)",  "Specify the bit rate in bits per second." );
-	mBitRateInterface.SetMax( 10000000 );
+	mBitRateInterface.SetMax( 2000000000 );
 	mBitRateInterface.SetMin( 1 );
 	mBitRateInterface.SetInteger( mBitRate );
 
-	mDropIdleFramesInterface.SetTitleAndTooltip( "Drop Idle Frames", "Drop idle frames from analysis output" );
-	mDropIdleFramesInterface.SetValue( mDropIdleFrames );
+	mDetectBitRateInterface.SetTitleAndTooltip( "Detect Bit Rate", "Measure the bit rate from the run lengths at the start of the capture and report it as the first frame. The bit rate above is used if no 8b/10b stream is recognized." );
+	mDetectBitRateInterface.SetCheckBoxText( "Detect from the capture" );
+	mDetectBitRateInterface.SetValue( mDetectBitRate );
+
+	mIdleModeInterface.SetTitleAndTooltip( "Idle Frames", "How idle symbols appear in the analysis output" );
+	mIdleModeInterface.AddNumber( ShowIdle, "Show", "One frame per idle symbol" );
+	mIdleModeInterface.AddNumber( DropIdle, "Drop", "Drop error-free idle frames from analysis output" );
+	mIdleModeInterface.AddNumber( MergeIdle, "Merge runs", "One frame per run of idle ordered sets; idle symbols with code or disparity errors are still shown" );
+	mIdleModeInterface.SetNumber( mIdleMode );
+
+	mProtocolLayerInterface.SetTitleAndTooltip( "Protocol Layer", "Decode level of the output frames" );
+	mProtocolLayerInterface.AddNumber( SymbolLayer, "Symbols", "One frame per 8b/10b symbol" );
+	mProtocolLayerInterface.AddNumber( OrderedSetLayer, "1000BASE-X / SGMII", "Group symbols into ordered sets (/I/, /C/, /R/, /V/) and packets between /S/ and /T/ with an Ethernet CRC check" );
+	mProtocolLayerInterface.SetNumber( mProtocolLayer );
+
+	mSamplingModeInterface.SetTitleAndTooltip( "Sampling", "How bits are recovered from the channel" );
+	mSamplingModeInterface.AddNumber( PerBitSampling, "Per bit", "Sample the channel at the center of every bit" );
+	mSamplingModeInterface.AddNumber( EdgeRunSampling, "Edge runs", "Measure the time between edges and convert each run to a bit count, faster on long runs and high sample rates" );
+	mSamplingModeInterface.AddNumber( ClockRecoverySampling, "Clock recovery (PLL)", "Track the actual bit period from the edges, for drifting or spread-spectrum links and sample rates down to 2.5x the bit rate" );
+	mSamplingModeInterface.SetNumber( mSamplingMode );
+
+	mBitOrderInterface.SetTitleAndTooltip( "Bit Order", "Order the bits of each 10-bit symbol are sent in" );
+	mBitOrderInterface.AddNumber( LsbFirst, "LSB first (standard)", "Bit a of each symbol is sent first, as specified for 8b/10b" );
+	mBitOrderInterface.AddNumber( MsbFirst, "MSB first", "Bit j of each symbol is sent first" );
+	mBitOrderInterface.SetNumber( mBitOrder );
+
+	mFrameV2SchemaInterface.SetTitleAndTooltip( "Frame Fields", "Data attached to each decoded frame for the data table, export and high level analyzers" );
+	mFrameV2SchemaInterface.AddNumber( FullFrameV2, "Full", "Symbol name, decoded octet, disparity and error text" );
+	mFrameV2SchemaInterface.AddNumber( CompactFrameV2, "Compact", "Integer codes only, uses less memory on large captures" );
+	mFrameV2SchemaInterface.SetNumber( mFrameV2Schema );
+
+	mCommitBatchFramesInterface.SetTitleAndTooltip( "Commit Batch (Frames)", "Number of decoded frames made visible at once, larger batches decode faster" );
+	mCommitBatchFramesInterface.SetMax( 1000000 );
+	mCommitBatchFramesInterface.SetMin( 1 );
+	mCommitBatchFramesInterface.SetInteger( mCommitBatchFrames );
+
+	mCommitSpanSamplesInterface.SetTitleAndTooltip( "Commit Span (Samples)", "Also make frames visible once this many samples have been decoded since the last batch, 0 disables" );
+	mCommitSpanSamplesInterface.SetMax( 2000000000 );
+	mCommitSpanSamplesInterface.SetMin( 0 );
+	mCommitSpanSamplesInterface.SetInteger( mCommitSpanSamples );
+
+	mLossOfSyncErrorsInterface.SetTitleAndTooltip( "Loss of Sync Errors", "Drop symbol lock and hunt for a comma after this many code or disparity errors within the window, 0 never drops lock" );
+	mLossOfSyncErrorsInterface.SetMax( 64 );
+	mLossOfSyncErrorsInterface.SetMin( 0 );
+	mLossOfSyncErrorsInterface.SetInteger( mLossOfSyncErrors );
+
+	mLossOfSyncWindowInterface.SetTitleAndTooltip( "Loss of Sync Window (Symbols)", "Number of consecutive symbols the loss of sync errors must fall within" );
+	mLossOfSyncWindowInterface.SetMax( 65536 );
+	mLossOfSyncWindowInterface.SetMin( 1 );
+	mLossOfSyncWindowInterface.SetInteger( mLossOfSyncWindow );
+
+	mSimulationTrafficInterface.SetTitleAndTooltip( "Simulation Traffic", "Symbol stream produced by the simulation data generator" );
+	mSimulationTrafficInterface.AddNumber( IdleTraffic, "Idle", "Idle ordered sets only" );
+	mSimulationTrafficInterface.AddNumber( PacketTraffic, "Packets", "1000BASE-X packets with PRBS payloads and a valid Ethernet FCS, separated by idles" );
+	mSimulationTrafficInterface.AddNumber( PrbsTraffic, "PRBS-7", "PRBS-7 data octets with a K28.5 comma every 16 symbols" );
+	mSimulationTrafficInterface.SetNumber( mSimulationTraffic );
+
+	mSimulationErrorIntervalInterface.SetTitleAndTooltip( "Simulation Error Interval (Symbols)", "Inject a code error, a disparity error or a bit slip, in turn, every this many simulated symbols, 0 disables" );
+	mSimulationErrorIntervalInterface.SetMax( 1000000 );
+	mSimulationErrorIntervalInterface.SetMin( 0 );
+	mSimulationErrorIntervalInterface.SetInteger( mSimulationErrorInterval );
+
+	// Natural frequency of the loop as a fraction of the bit rate, at a damping of about 0.7 and the ~0.6 edges per bit of 8b/10b traffic
+	mPllGainShiftInterface.SetTitleAndTooltip( "PLL Loop Bandwidth", "How quickly clock recovery follows changes in the bit rate, narrower loops ride through more jitter" );
+	mPllGainShiftInterface.AddNumber( 3, "Wide (bit rate / 120)", "Follows fast frequency changes, most sensitive to edge jitter" );
+	mPllGainShiftInterface.AddNumber( 4, "Medium (bit rate / 240)", "Balances tracking speed against jitter tolerance" );
+	mPllGainShiftInterface.AddNumber( 5, "Narrow (bit rate / 470)", "Tracks spread-spectrum clocking and crystal offsets" );
+	mPllGainShiftInterface.AddNumber( 6, "Very narrow (bit rate / 950)", "For stable clocks with heavy edge jitter" );
+	mPllGainShiftInterface.SetNumber( mPllGainShift );
+
+	// Extra lanes are optional; a link decodes as one lane until the first of them is picked
+	static const char* const lane_titles[ MaxLanes - 1 ] = { "Lane 1", "Lane 2", "Lane 3" };
+	for( U32 i = 0; i < MaxLanes - 1; i++ )
+	{
+		mLaneChannels[ i ] = UNDEFINED_CHANNEL;
+		mLaneChannelInterfaces[ i ].SetTitleAndTooltip( lane_titles[ i ], "Another lane of a multi-lane link, with the Serial channel as lane 0. The lanes are decoded in parallel and shown as one frame per column; protocol layer and idle settings do not apply." );
+		mLaneChannelInterfaces[ i ].SetChannel( mLaneChannels[ i ] );
+		mLaneChannelInterfaces[ i ].SetSelectionOfNoneIsAllowed( true );
+	}
+
+	mAlignmentCharacterInterface.SetTitleAndTooltip( "Lane Alignment", "Character every lane sends in the same column, used to line the lanes up" );
+	mAlignmentCharacterInterface.AddNumber( AlignOnK28_3, "K28.3 (/A/)", "XAUI alignment columns and JESD204 multiframe ends" );
+	mAlignmentCharacterInterface.AddNumber( AlignOnK28_0, "K28.0 (/R/)", "Start of the JESD204 initial lane alignment sequence" );
+	mAlignmentCharacterInterface.AddNumber( AlignOnK28_5, "K28.5 (comma)", "Links that send their commas on all lanes at once" );
+	mAlignmentCharacterInterface.SetNumber( mAlignmentCharacter );
+
+	mLiveLatencyMsInterface.SetTitleAndTooltip( "Live Latency (ms)", "Keep decoding while a capture is running, through quiet stretches, and show each frame at most this long after its data arrived. Idle runs are split where they are shown. Single lane only; 0 decodes the data there is when the analyzer runs." );
+	mLiveLatencyMsInterface.SetMax( 10000 );
+	mLiveLatencyMsInterface.SetMin( 0 );
+	mLiveLatencyMsInterface.SetInteger( mLiveLatencyMs );
 
 	AddInterface( &mInputChannelInterface );
+	for( U32 i = 0; i < MaxLanes - 1; i++ )
+		AddInterface( &mLaneChannelInterfaces[ i ] );
+	AddInterface( &mAlignmentCharacterInterface );
 	AddInterface( &mBitRateInterface );
-	AddInterface( &mDropIdleFramesInterface );
+	AddInterface( &mDetectBitRateInterface );
+	AddInterface( &mIdleModeInterface );
+	AddInterface( &mProtocolLayerInterface );
+	AddInterface( &mSamplingModeInterface );
+	AddInterface( &mPllGainShiftInterface );
+	AddInterface( &mBitOrderInterface );
+	AddInterface( &mFrameV2SchemaInterface );
+	AddInterface( &mCommitBatchFramesInterface );
+	AddInterface( &mCommitSpanSamplesInterface );
+	AddInterface( &mLiveLatencyMsInterface );
+	AddInterface( &mLossOfSyncErrorsInterface );
+	AddInterface( &mLossOfSyncWindowInterface );
+	AddInterface( &mSimulationTrafficInterface );
+	AddInterface( &mSimulationErrorIntervalInterface );
 
 	AddExportOption( 0, "Export as text/csv file" );
 	AddExportExtension( 0, "text", "txt" );
 	AddExportExtension( 0, "csv", "csv" );
 
+	AddExportOption( 1, "Export as binary symbol records" );
+	AddExportExtension( 1, "binary", "bin" );
+
 	ClearChannels();
 	AddChannel( mInputChannel, "Serial", false );
+	for( U32 i = 0; i < MaxLanes - 1; i++ )
+		AddChannel( mLaneChannels[ i ], lane_titles[ i ], false );
 }
 
 decode8b10bAnalyzerSettings::~decode8b10bAnalyzerSettings()
@@ -39,12 +176,60 @@ decode8b10bAnalyzerSettings::~decode8b10bAnalyzerSettings()
 
 bool decode8b10bAnalyzerSettings::SetSettingsFromInterfaces()
 {
+	// Lanes are numbered in the order they are picked, so none may be skipped or share a channel
+	Channel input_channel = mInputChannelInterface.GetChannel();
+	for( U32 i = 0; i < MaxLanes - 1; i++ )
+	{
+		Channel lane_channel = mLaneChannelInterfaces[ i ].GetChannel();
+		if( lane_channel == UNDEFINED_CHANNEL )
+			continue;
+
+		if( i > 0 && mLaneChannelInterfaces[ i - 1 ].GetChannel() == UNDEFINED_CHANNEL )
+		{
+			SetErrorText( "Please pick the lane channels in order, starting with Lane 1." );
+			return false;
+		}
+
+		bool shared = ( lane_channel == input_channel );
+		for( U32 j = 0; j < i; j++ )
+			shared = shared || ( lane_channel == mLaneChannelInterfaces[ j ].GetChannel() );
+		if( shared )
+		{
+			SetErrorText( "Each lane needs a channel of its own." );
+			return false;
+		}
+	}
+
+	// The lanes are lined up from blocks of symbols, which a live capture may take any time to fill
+	if( mLiveLatencyMsInterface.GetInteger() != 0 && mLaneChannelInterfaces[ 0 ].GetChannel() != UNDEFINED_CHANNEL )
+	{
+		SetErrorText( "Live decoding is for single lane links; set Live Latency to 0 to decode several lanes." );
+		return false;
+	}
+
 	mInputChannel = mInputChannelInterface.GetChannel();
 	mBitRate = mBitRateInterface.GetInteger();
-	mDropIdleFrames = mDropIdleFramesInterface.GetValue();
+	mDetectBitRate = mDetectBitRateInterface.GetValue();
+	mIdleMode = IdleMode( U32( mIdleModeInterface.GetNumber() ) );
+	mProtocolLayer = ProtocolLayer( U32( mProtocolLayerInterface.GetNumber() ) );
+	mSamplingMode = SamplingMode( U32( mSamplingModeInterface.GetNumber() ) );
+	mBitOrder = BitOrder( U32( mBitOrderInterface.GetNumber() ) );
+	mFrameV2Schema = FrameV2Schema( U32( mFrameV2SchemaInterface.GetNumber() ) );
+	mCommitBatchFrames = mCommitBatchFramesInterface.GetInteger();
+	mCommitSpanSamples = mCommitSpanSamplesInterface.GetInteger();
+	mLossOfSyncErrors = mLossOfSyncErrorsInterface.GetInteger();
+	mLossOfSyncWindow = mLossOfSyncWindowInterface.GetInteger();
+	mSimulationTraffic = SimulationTraffic( U32( mSimulationTrafficInterface.GetNumber() ) );
+	mSimulationErrorInterval = mSimulationErrorIntervalInterface.GetInteger();
+	mPllGainShift = U32( mPllGainShiftInterface.GetNumber() );
+	for( U32 i = 0; i < MaxLanes - 1; i++ )
+		mLaneChannels[ i ] = mLaneChannelInterfaces[ i ].GetChannel();
+	mAlignmentCharacter = AlignmentCharacter( U32( mAlignmentCharacterInterface.GetNumber() ) );
+	mLiveLatencyMs = mLiveLatencyMsInterface.GetInteger();
 
 	ClearChannels();
 	AddChannel( mInputChannel, "8b10b Decoder", true );
+	AddLaneChannels();
 
 	return true;
 }
@@ -53,7 +238,38 @@ void decode8b10bAnalyzerSettings::UpdateInterfacesFromSettings()
 {
 	mInputChannelInterface.SetChannel( mInputChannel );
 	mBitRateInterface.SetInteger( mBitRate );
-	mDropIdleFramesInterface.SetValue( mDropIdleFrames );
+	mDetectBitRateInterface.SetValue( mDetectBitRate );
+	mIdleModeInterface.SetNumber( mIdleMode );
+	mSamplingModeInterface.SetNumber( mSamplingMode );
+	mLossOfSyncErrorsInterface.SetInteger( mLossOfSyncErrors );
+	mLossOfSyncWindowInterface.SetInteger( mLossOfSyncWindow );
+	mBitOrderInterface.SetNumber( mBitOrder );
+	mCommitBatchFramesInterface.SetInteger( mCommitBatchFrames );
+	mCommitSpanSamplesInterface.SetInteger( mCommitSpanSamples );
+	mFrameV2SchemaInterface.SetNumber( mFrameV2Schema );
+	mProtocolLayerInterface.SetNumber( mProtocolLayer );
+	mSimulationTrafficInterface.SetNumber( mSimulationTraffic );
+	mSimulationErrorIntervalInterface.SetInteger( mSimulationErrorInterval );
+	mPllGainShiftInterface.SetNumber( mPllGainShift );
+	for( U32 i = 0; i < MaxLanes - 1; i++ )
+		mLaneChannelInterfaces[ i ].SetChannel( mLaneChannels[ i ] );
+	mAlignmentCharacterInterface.SetNumber( mAlignmentCharacter );
+	mLiveLatencyMsInterface.SetInteger( mLiveLatencyMs );
+}
+
+U32 decode8b10bAnalyzerSettings::GetLaneCount() const
+{
+	U32 lane_count = 1;
+	while( lane_count < MaxLanes && mLaneChannels[ lane_count - 1 ] != UNDEFINED_CHANNEL )
+		lane_count++;
+	return lane_count;
+}
+
+void decode8b10bAnalyzerSettings::AddLaneChannels()
+{
+	static const char* const lane_labels[ MaxLanes - 1 ] = { "8b10b Lane 1", "8b10b Lane 2", "8b10b Lane 3" };
+	for( U32 i = 0; i < MaxLanes - 1; i++ )
+		AddChannel( mLaneChannels[ i ], lane_labels[ i ], mLaneChannels[ i ] != UNDEFINED_CHANNEL );
 }
 
 void decode8b10bAnalyzerSettings::LoadSettings( const char* settings )
@@ -61,12 +277,80 @@ void decode8b10bAnalyzerSettings::LoadSettings( const char* settings )
 	SimpleArchive text_archive;
 	text_archive.SetString( settings );
 
+	// Settings saved before a setting existed keep its default. So do values out of range, from a damaged settings
+	// string or a newer version: every number is only taken within what its interface offers.
 	text_archive >> mInputChannel;
-	text_archive >> mBitRate;
-	text_archive >> mDropIdleFrames;
+	U32 bit_rate;
+	if( ( text_archive >> bit_rate ) && bit_rate >= 1 && bit_rate <= 2000000000 )
+		mBitRate = bit_rate;
+
+	// Stored as the old "Drop Idle Frames" flag, the full mode follows at the end
+	bool drop_idle_frames;
+	if( text_archive >> drop_idle_frames )
+		mIdleMode = drop_idle_frames ? DropIdle : ShowIdle;
+
+	U32 sampling_mode;
+	if( ( text_archive >> sampling_mode ) && sampling_mode <= ClockRecoverySampling )
+		mSamplingMode = SamplingMode( sampling_mode );
+
+	// The decoder keeps a slot per allowed error, so the limits matter beyond what the interfaces offer
+	U32 loss_of_sync_errors;
+	if( ( text_archive >> loss_of_sync_errors ) && loss_of_sync_errors <= 64 )
+		mLossOfSyncErrors = loss_of_sync_errors;
+	U32 loss_of_sync_window;
+	if( ( text_archive >> loss_of_sync_window ) && loss_of_sync_window >= 1 && loss_of_sync_window <= 65536 )
+		mLossOfSyncWindow = loss_of_sync_window;
+
+	U32 bit_order;
+	if( ( text_archive >> bit_order ) && bit_order <= MsbFirst )
+		mBitOrder = BitOrder( bit_order );
+
+	U32 commit_batch_frames;
+	if( ( text_archive >> commit_batch_frames ) && commit_batch_frames >= 1 && commit_batch_frames <= 1000000 )
+		mCommitBatchFrames = commit_batch_frames;
+	U32 commit_span_samples;
+	if( ( text_archive >> commit_span_samples ) && commit_span_samples <= 2000000000 )
+		mCommitSpanSamples = commit_span_samples;
+
+	U32 frame_v2_schema;
+	if( ( text_archive >> frame_v2_schema ) && frame_v2_schema <= CompactFrameV2 )
+		mFrameV2Schema = FrameV2Schema( frame_v2_schema );
+
+	U32 idle_mode;
+	if( ( text_archive >> idle_mode ) && idle_mode <= MergeIdle )
+		mIdleMode = IdleMode( idle_mode );
+
+	U32 protocol_layer;
+	if( ( text_archive >> protocol_layer ) && protocol_layer <= OrderedSetLayer )
+		mProtocolLayer = ProtocolLayer( protocol_layer );
+
+	U32 simulation_traffic;
+	if( ( text_archive >> simulation_traffic ) && simulation_traffic <= PrbsTraffic )
+		mSimulationTraffic = SimulationTraffic( simulation_traffic );
+	U32 simulation_error_interval;
+	if( ( text_archive >> simulation_error_interval ) && simulation_error_interval <= 1000000 )
+		mSimulationErrorInterval = simulation_error_interval;
+
+	// The loop gains are shifts, anything past the offered bandwidths would shift out of range
+	U32 pll_gain_shift;
+	if( ( text_archive >> pll_gain_shift ) && pll_gain_shift >= 3 && pll_gain_shift <= 6 )
+		mPllGainShift = pll_gain_shift;
+	text_archive >> mDetectBitRate;
+	for( U32 i = 0; i < MaxLanes - 1; i++ )
+		text_archive >> mLaneChannels[ i ];
+
+	U32 alignment_character;
+	if( ( text_archive >> alignment_character ) &&
+		( alignment_character == AlignOnK28_3 || alignment_character == AlignOnK28_0 || alignment_character == AlignOnK28_5 ) )
+		mAlignmentCharacter = AlignmentCharacter( alignment_character );
+
+	U32 live_latency_ms;
+	if( ( text_archive >> live_latency_ms ) && live_latency_ms <= 10000 )
+		mLiveLatencyMs = live_latency_ms;
 
 	ClearChannels();
 	AddChannel( mInputChannel, "8b10b Decoder", true );
+	AddLaneChannels();
 
 	UpdateInterfacesFromSettings();
 }
@@ -77,7 +361,24 @@ const char* decode8b10bAnalyzerSettings::SaveSettings()
 
 	text_archive << mInputChannel;
 	text_archive << mBitRate;
-	text_archive << mDropIdleFrames;
+	text_archive << ( mIdleMode == DropIdle );
+	text_archive << U32( mSamplingMode );
+	text_archive << mLossOfSyncErrors;
+	text_archive << mLossOfSyncWindow;
+	text_archive << U32( mBitOrder );
+	text_archive << mCommitBatchFrames;
+	text_archive << mCommitSpanSamples;
+	text_archive << U32( mFrameV2Schema );
+	text_archive << U32( mIdleMode );
+	text_archive << U32( mProtocolLayer );
+	text_archive << U32( mSimulationTraffic );
+	text_archive << mSimulationErrorInterval;
+	text_archive << mPllGainShift;
+	text_archive << mDetectBitRate;
+	for( U32 i = 0; i < MaxLanes - 1; i++ )
+		text_archive << mLaneChannels[ i ];
+	text_archive << U32( mAlignmentCharacter );
+	text_archive << mLiveLatencyMs;
 
 	return SetReturnString( text_archive.GetString() );
 }
@@ -15,15 +15,97 @@ public:
 	virtual void LoadSettings( const char* settings );
 	virtual const char* SaveSettings();
 
+	enum SamplingMode
+	{
+		PerBitSampling,       // sample the channel at every bit center
+		EdgeRunSampling,      // measure runs between edges, SDK calls scale with transitions
+		ClockRecoverySampling // edge runs measured against a bit clock a PLL recovers from the edges
+	};
 	
+	enum BitOrder
+	{
+		LsbFirst, // standard 8b/10b: bit a of each symbol is sent first
+		MsbFirst  // bit j of each symbol is sent first
+	};
+
+	enum FrameV2Schema
+	{
+		FullFrameV2,    // text fields: Name, Disparity, Error
+		CompactFrameV2  // integer fields only: Code, Decoded Octet, Disparity (-1/0/+1), Error
+	};
+
+	enum IdleMode
+	{
+		ShowIdle,  // one frame per idle symbol
+		DropIdle,  // no frames for error-free idle symbols
+		MergeIdle  // one frame per run of error-free idle ordered sets
+	};
+
+	enum ProtocolLayer
+	{
+		SymbolLayer,     // one frame per symbol
+		OrderedSetLayer  // 1000BASE-X / SGMII ordered sets and packets
+	};
+
+	enum AlignmentCharacter
+	{
+		AlignOnK28_3 = 0x17C, // /A/, XAUI and JESD204
+		AlignOnK28_0 = 0x11C, // /R/, the first character of a JESD204 initial lane alignment multiframe
+		AlignOnK28_5 = 0x1BC  // comma, for links that send it on every lane at once
+	};
+
+	enum { MaxLanes = 4 }; // decode8b10bLaneDeskew::MaxLanes
+
+	enum SimulationTraffic
+	{
+		IdleTraffic,   // /I1/ and /I2/ idle ordered sets only
+		PacketTraffic, // 1000BASE-X packets with a valid FCS between idles
+		PrbsTraffic    // PRBS-7 data octets, each block of 15 led by a K28.5 comma
+	};
+
 	Channel mInputChannel;
 	U32 mBitRate;
-	bool mDropIdleFrames;
+	bool mDetectBitRate; // measure the bit rate from the first edges, mBitRate is the fallback
+	IdleMode mIdleMode;
+	ProtocolLayer mProtocolLayer;
+	SamplingMode mSamplingMode;
+	BitOrder mBitOrder;
+	FrameV2Schema mFrameV2Schema;
+	U32 mCommitBatchFrames;
+	U32 mCommitSpanSamples; // 0 commits by frame count only
+	U32 mLossOfSyncErrors; // 0 keeps lock for the whole capture
+	U32 mLossOfSyncWindow;
+	SimulationTraffic mSimulationTraffic;
+	U32 mSimulationErrorInterval; // symbols between injected errors, 0 for a clean stream
+	U32 mPllGainShift; // clock recovery loop gains are 2^-shift and 2^-(2 * shift + 1)
+	Channel mLaneChannels[ MaxLanes - 1 ]; // lanes 1 and up, lane 0 is mInputChannel; unused ones are UNDEFINED_CHANNEL
+	AlignmentCharacter mAlignmentCharacter;
+	U32 mLiveLatencyMs; // 0 decodes the data the capture holds and stops
+
+	// 1 plus the lane channels in use, which are always the first ones
+	U32 GetLaneCount() const;
 
 protected:
+	void AddLaneChannels();
+
 	AnalyzerSettingInterfaceChannel	mInputChannelInterface;
 	AnalyzerSettingInterfaceInteger	mBitRateInterface;
-	AnalyzerSettingInterfaceBool	mDropIdleFramesInterface;
+	AnalyzerSettingInterfaceBool	mDetectBitRateInterface;
+	AnalyzerSettingInterfaceNumberList	mIdleModeInterface;
+	AnalyzerSettingInterfaceNumberList	mProtocolLayerInterface;
+	AnalyzerSettingInterfaceNumberList	mSamplingModeInterface;
+	AnalyzerSettingInterfaceNumberList	mBitOrderInterface;
+	AnalyzerSettingInterfaceNumberList	mFrameV2SchemaInterface;
+	AnalyzerSettingInterfaceInteger	mCommitBatchFramesInterface;
+	AnalyzerSettingInterfaceInteger	mCommitSpanSamplesInterface;
+	AnalyzerSettingInterfaceInteger	mLossOfSyncErrorsInterface;
+	AnalyzerSettingInterfaceInteger	mLossOfSyncWindowInterface;
+	AnalyzerSettingInterfaceNumberList	mSimulationTrafficInterface;
+	AnalyzerSettingInterfaceInteger	mSimulationErrorIntervalInterface;
+	AnalyzerSettingInterfaceNumberList	mPllGainShiftInterface;
+	AnalyzerSettingInterfaceChannel	mLaneChannelInterfaces[ MaxLanes - 1 ];
+	AnalyzerSettingInterfaceNumberList	mAlignmentCharacterInterface;
+	AnalyzerSettingInterfaceInteger	mLiveLatencyMsInterface;
 };
 
 #endif //DECODE8B10B_ANALYZER_SETTINGS
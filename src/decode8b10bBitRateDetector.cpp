@@ -0,0 +1,79 @@
+#include "decode8b10bBitRateDetector.h"
+#include <algorithm>
+#include <cmath>
+
+decode8b10bBitRateDetector::Estimate decode8b10bBitRateDetector::Detect( const std::vector<U64>& edges, U64 sample_rate )
+{
+	Estimate estimate = { false, 0.0, 0, 0, 0 };
+	if( edges.size() <= MinimumRuns || sample_rate == 0 )
+		return estimate;
+
+	std::vector<U64> runs;
+	runs.reserve( edges.size() - 1 );
+	for( size_t i = 1; i < edges.size(); i++ )
+		runs.push_back( edges[ i ] - edges[ i - 1 ] );
+
+	// The 10th percentile of the run lengths lands in the one-bit peak as long as glitches are rarer than that
+	std::vector<U64> sorted( runs );
+	std::nth_element( sorted.begin(), sorted.begin() + sorted.size() / 10, sorted.end() );
+	U64 percentile = sorted[ sorted.size() / 10 ];
+	if( percentile == 0 )
+		return estimate;
+
+	// Sampling and jitter spread the peak over neighbouring lengths; their mean is the first estimate, close
+	// enough at a few samples per bit that the fit below does not round runs to the wrong bit count
+	U64 peak_samples = 0;
+	U64 peak_runs = 0;
+	for( U64 run : runs )
+	{
+		if( 2 * run >= percentile && 2 * run <= 3 * percentile )
+		{
+			peak_samples += run;
+			peak_runs++;
+		}
+	}
+	double samples_per_bit = double( peak_samples ) / double( peak_runs );
+
+	U32 single_bit_runs = 0;
+	for( int pass = 0; pass < 4; pass++ )
+	{
+		U64 fitted_samples = 0;
+		U64 fitted_bits = 0;
+		estimate.mRuns = 0;
+		estimate.mFittedRuns = 0;
+		single_bit_runs = 0;
+
+		for( U64 run : runs )
+		{
+			double bits = double( run ) / samples_per_bit;
+			if( bits > 5.5 )
+				continue; // a pause in the traffic rather than a run
+
+			estimate.mRuns++;
+			U64 whole_bits = U64( bits + 0.5 );
+			if( whole_bits == 0 || std::fabs( bits - double( whole_bits ) ) > 1.0 / 3 )
+				continue;
+
+			fitted_samples += run;
+			fitted_bits += whole_bits;
+			estimate.mFittedRuns++;
+			if( whole_bits == 1 )
+				single_bit_runs++;
+		}
+
+		if( fitted_bits == 0 )
+			return estimate;
+		samples_per_bit = double( fitted_samples ) / double( fitted_bits );
+	}
+
+	// Nine runs in ten must fit, and a period of half the real one would fit every run to an even count
+	// with no single bits at all
+	estimate.mDetected = estimate.mFittedRuns >= MinimumRuns && U64( estimate.mFittedRuns ) * 10 >= U64( estimate.mRuns ) * 9 &&
+						 U64( single_bit_runs ) * 10 >= estimate.mFittedRuns;
+	if( !estimate.mDetected )
+		return estimate;
+
+	estimate.mSamplesPerBit = samples_per_bit;
+	estimate.mBitRate = U32( std::min( double( sample_rate ) / samples_per_bit + 0.5, 4294967295.0 ) );
+	return estimate;
+}
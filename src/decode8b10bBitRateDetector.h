@@ -0,0 +1,33 @@
+#ifndef DECODE8B10B_BIT_RATE_DETECTOR_H
+#define DECODE8B10B_BIT_RATE_DETECTOR_H
+
+#include <AnalyzerTypes.h>
+#include <vector>
+
+// Estimates the bit rate of an 8b/10b stream from the runs between its edges. The code never sends more than
+// five equal bits in a row and single-bit runs make up a large share of any traffic, idle included, so the
+// one-bit peak is the lowest well populated part of the run length histogram. Each run is then fitted to a whole
+// number of bits from 1 to 5 and the bit period refined over all of them. Only AnalyzerTypes.h from the SDK.
+class decode8b10bBitRateDetector
+{
+public:
+	enum
+	{
+		DetectionEdges = 4096, // edges measured from the start of a capture
+		MinimumRuns = 64       // fewer fitted runs than this is no estimate
+	};
+
+	struct Estimate
+	{
+		bool mDetected;        // false when the runs do not look like 8b/10b at any bit rate
+		double mSamplesPerBit;
+		U32 mBitRate;          // sample rate / samples per bit, rounded; 0 if not detected
+		U32 mRuns;             // runs measured, not counting gaps longer than five bits
+		U32 mFittedRuns;       // runs within a third of a bit of 1 to 5 whole bits
+	};
+
+	// edges are consecutive edge sample numbers in increasing order
+	static Estimate Detect( const std::vector<U64>& edges, U64 sample_rate );
+};
+
+#endif // DECODE8B10B_BIT_RATE_DETECTOR_H
@@ -0,0 +1,186 @@
+#ifndef DECODE8B10B_DECODE_PIPELINE_H
+#define DECODE8B10B_DECODE_PIPELINE_H
+
+#include <AnalyzerTypes.h>
+#include "decode8b10bEdgeRing.h"
+#include "decode8b10bLaneQueue.h"
+#include <exception>
+#include <memory>
+#include <thread>
+#include <vector>
+
+// Decodes up to MaxLanes channels with a decoder thread per lane, and everything else on the thread driving it:
+// that thread walks the channels into the lanes' edge rings with Fill and plays the decoders' results back with
+// Drain, in turn and without ever waiting on a decoder. In the plugin this is the analyzer's worker thread, so
+// the SDK's channel access and the frames, commits and progress reports all stay on the thread the SDK made. The
+// decoder threads only ever wait on their ring or queue, and both are cancelled before the threads are joined, so
+// a pipeline left by an exception cleans up in its destructor.
+class decode8b10bDecodePipeline
+{
+public:
+	enum
+	{
+		MaxLanes = 4,
+		DrainEvents = 4096 // most Drain plays back at once, so the rings are kept filled meanwhile
+	};
+
+	class Listener
+	{
+	public:
+		virtual ~Listener() {}
+		virtual void OnLaneEvent( U32 lane, const decode8b10bLaneQueue::Event& event ) = 0;
+	};
+
+	decode8b10bDecodePipeline()
+	:	mLaneCount( 0 )
+	{
+	}
+
+	~decode8b10bDecodePipeline()
+	{
+		Cancel();
+		Join();
+	}
+
+	// Starts a thread per lane calling decode( lane, ring, queue ), which decodes the edges in ring into queue.
+	// Anything decode refers to has to outlive the pipeline. Streaming, a decoder that runs out of edges hands
+	// over what it has decoded so far and tells TakeIdle.
+	template <class Decode>
+	void Start( U32 lane_count, bool streaming, Decode decode )
+	{
+		mLaneCount = lane_count;
+		for( U32 lane = 0; lane < lane_count; lane++ )
+		{
+			mRings[ lane ].reset( new decode8b10bEdgeRing );
+			mQueues[ lane ].reset( new decode8b10bLaneQueue );
+			mLaneOpen[ lane ] = true;
+			mLaneFinished[ lane ] = false;
+			mNextEvent[ lane ] = 0;
+			if( streaming )
+				mRings[ lane ]->SetIdleListener( mQueues[ lane ].get() );
+		}
+
+		for( U32 lane = 0; lane < lane_count; lane++ )
+		{
+			mThreads.push_back( std::thread( [this, lane, decode]() {
+				try
+				{
+					decode( lane, *mRings[ lane ], *mQueues[ lane ] );
+				}
+				catch( ... )
+				{
+					mErrors[ lane ] = std::current_exception();
+					Cancel();
+				}
+				mQueues[ lane ]->Close();
+			} ) );
+		}
+	}
+
+	// Hands the lane's ring a batch of source's edges if it has room, without waiting. False once source has no
+	// more transitions, or the decode has been cancelled; streaming, a lane stays open for the data still to come.
+	// fed tells whether any edge was handed over.
+	template <class Source>
+	bool Fill( U32 lane, Source& source, bool streaming, bool& fed )
+	{
+		fed = false;
+		if( mLaneOpen[ lane ] )
+			mLaneOpen[ lane ] = mRings[ lane ]->FillBatch( source, streaming, fed );
+		return mLaneOpen[ lane ];
+	}
+
+	// Plays the decoded results back onto sink's OnLaneEvent, in order of sample across the lanes, as far as every
+	// lane has got: a lane with nothing queued yet holds the others back until it has. took tells whether anything
+	// was played back. False once every decoder has finished and all its results have been played back.
+	template <class Sink>
+	bool Drain( Sink& sink, bool& took )
+	{
+		took = false;
+		for( U32 events = 0; events < DrainEvents; events++ )
+		{
+			U32 earliest = mLaneCount;
+			for( U32 lane = 0; lane < mLaneCount; lane++ )
+			{
+				if( mNextEvent[ lane ] == mBlocks[ lane ].size() && !mLaneFinished[ lane ] )
+				{
+					mNextEvent[ lane ] = 0;
+					if( !mQueues[ lane ]->TryPop( mBlocks[ lane ], mLaneFinished[ lane ] ) )
+					{
+						mBlocks[ lane ].clear();
+						if( !mLaneFinished[ lane ] )
+							return true;
+					}
+				}
+				if( mNextEvent[ lane ] == mBlocks[ lane ].size() )
+					continue;
+
+				if( earliest == mLaneCount || GetNextSample( lane ) < GetNextSample( earliest ) )
+					earliest = lane;
+			}
+			if( earliest == mLaneCount )
+				return false;
+
+			took = true;
+			sink.OnLaneEvent( earliest, mBlocks[ earliest ][ mNextEvent[ earliest ]++ ] );
+		}
+		return true;
+	}
+
+	// Streaming: whether every decoder has run out of edges since the last call, with what it decoded until then
+	// queued for Drain
+	bool TakeIdle()
+	{
+		bool idle = true;
+		for( U32 lane = 0; lane < mLaneCount; lane++ )
+			idle = mQueues[ lane ]->TakeIdle() && idle;
+		return idle;
+	}
+
+	// Once Drain has returned false: joins the decoder threads and rethrows the first error one of them raised
+	void Finish()
+	{
+		Join();
+		for( U32 lane = 0; lane < mLaneCount; lane++ )
+		{
+			if( mErrors[ lane ] )
+				std::rethrow_exception( mErrors[ lane ] );
+		}
+	}
+
+protected:
+	U64 GetNextSample( U32 lane ) const
+	{
+		return mBlocks[ lane ][ mNextEvent[ lane ] ].mSymbol.mStart;
+	}
+
+	// Ends every decoder where it is, along with the filling and draining
+	void Cancel()
+	{
+		for( U32 lane = 0; lane < mLaneCount; lane++ )
+		{
+			mRings[ lane ]->Cancel();
+			mQueues[ lane ]->Cancel();
+		}
+	}
+
+	void Join()
+	{
+		for( std::thread& thread : mThreads )
+			thread.join();
+		mThreads.clear();
+	}
+
+	U32 mLaneCount;
+	std::unique_ptr<decode8b10bEdgeRing> mRings[ MaxLanes ]; // only the lanes in use, a ring is half a megabyte
+	std::unique_ptr<decode8b10bLaneQueue> mQueues[ MaxLanes ];
+	std::vector<std::thread> mThreads;
+	std::exception_ptr mErrors[ MaxLanes ];
+
+	// Filling and draining, on the driving thread
+	bool mLaneOpen[ MaxLanes ];
+	bool mLaneFinished[ MaxLanes ];
+	decode8b10bLaneQueue::Block mBlocks[ MaxLanes ];
+	size_t mNextEvent[ MaxLanes ];
+};
+
+#endif // DECODE8B10B_DECODE_PIPELINE_H
@@ -0,0 +1,189 @@
+#ifndef DECODE8B10B_DECODER_CORE_H
+#define DECODE8B10B_DECODER_CORE_H
+
+#include <AnalyzerTypes.h>
+#include "decode8b10bSymbolDecoder.h"
+#include <algorithm>
+
+// Bit recovery from a sampled channel, feeding decode8b10bSymbolDecoder. Templated on where the samples come
+// from and where the symbols go, so the same code runs in the plugin and against synthetic edge streams.
+//
+// Source: AnalyzerChannelData, or anything with the same GetSampleNumber, GetBitState, AdvanceToAbsPosition,
+//         AdvanceToNextEdge, GetSampleOfNextEdge, WouldAdvancingToAbsPositionCauseTransition and
+//         DoMoreTransitionsExistInCurrentData calls (see decode8b10bEdgeSource).
+// Sink:   OnSymbolDecoded, OnSyncEvent and OnSyncLost as in decode8b10bSymbolDecoder::Listener.
+template <class Source, class Sink>
+class decode8b10bDecoderCore
+{
+public:
+	decode8b10bDecoderCore( Source& source, Sink& sink )
+	:	mSource( source ),
+		mSink( sink ),
+		mBitPeriod( U64( 1 ) << 32 )
+	{
+	}
+
+	// bit_period is samples per bit in 32.32 fixed point, see decode8b10bSymbolDecoder::GetBitPeriod
+	void Start( U64 bit_period, bool msb_first, U32 loss_of_sync_errors, U32 loss_of_sync_window )
+	{
+		mBitPeriod = bit_period;
+
+		// Find first edge to start sampling
+		mSource.AdvanceToNextEdge();
+		mSource.AdvanceToNextEdge();
+
+		// Hunt for a comma to establish symbol alignment
+		mSymbolDecoder.Reset( mBitPeriod, msb_first, loss_of_sync_errors, loss_of_sync_window, mSource.GetSampleNumber() );
+	}
+
+	void DecodeBitByBit()
+	{
+		// Bit centers are placed from the last edge in fixed point, so a fractional bit period does not build up
+		// rounding error along a run. The first one is a sample short of one and a half bits in.
+		U64 edge = mSource.GetSampleNumber();
+		U64 center = mBitPeriod + mBitPeriod / 2 - ( U64( 1 ) << 32 );
+		mSource.AdvanceToAbsPosition( edge + ( center >> 32 ) );
+
+		for( ; ; )
+		{
+			// Sample current bit at its center
+			mSymbolDecoder.ShiftInBits( mSource.GetBitState(), 1, mSource.GetSampleNumber(), mSink );
+
+			// Move to next bit center
+			center += mBitPeriod;
+			if( mSource.WouldAdvancingToAbsPositionCauseTransition( edge + ( center >> 32 ) ) == false )
+			{
+				// No transition, just advance
+				mSource.AdvanceToAbsPosition( edge + ( center >> 32 ) );
+			}
+			else
+			{
+				// Transition detected, advance to next edge and the middle of the bit it starts
+				mSource.AdvanceToNextEdge();
+				edge = mSource.GetSampleNumber();
+				center = mBitPeriod / 2;
+				mSource.AdvanceToAbsPosition( edge + ( center >> 32 ) );
+			}
+
+			// Check for end of data
+			if( mSource.DoMoreTransitionsExistInCurrentData() == false )
+				break;
+		}
+	}
+
+	void DecodeEdgeRuns()
+	{
+		// Each inter-edge interval is a run of identical bits, so the source is only touched once per transition
+		U64 run_start = mSource.GetSampleNumber();
+		BitState bit_state = mSource.GetBitState();
+		U64 samples_to_bit_center = mBitPeriod >> 33;
+
+		for( ; ; )
+		{
+			// Check for end of data
+			if( mSource.DoMoreTransitionsExistInCurrentData() == false )
+				break;
+
+			U64 run_end = mSource.GetSampleOfNextEdge();
+
+			// Round to the nearest whole bit; pulses shorter than half a bit are treated as glitches
+			U64 num_bits = GetBitsInRun( run_end - run_start );
+			if( num_bits > 0 )
+				mSymbolDecoder.ShiftInBits( bit_state, num_bits, run_start + samples_to_bit_center, mSink );
+
+			mSource.AdvanceToNextEdge();
+			run_start = run_end;
+			bit_state = Toggle( bit_state );
+		}
+	}
+
+	// Edge runs measured against a bit clock recovered by a second order digital PLL, so drifting and
+	// spread-spectrum bit rates decode as well as fractional ones. The loop starts at the bit period given to
+	// Start. Each edge corrects the bit grid by the phase error / 2^gain_shift and the period by the phase
+	// error / 2^(2 * gain_shift + 1), a damping of about 0.7.
+	void DecodeClockRecovery( U32 gain_shift )
+	{
+		const U64 nominal_period = mBitPeriod;
+
+		// The period may wander 1/8 either side of nominal before the loop gives up following it
+		const U64 min_period = nominal_period - ( nominal_period >> 3 );
+		const U64 max_period = nominal_period + ( nominal_period >> 3 );
+		U64 period = nominal_period;
+
+		// The start of the next bit is kept relative to the last edge, so the fixed-point values stay small
+		// however long the capture
+		U64 last_edge = mSource.GetSampleNumber();
+		S64 boundary = 0;
+		BitState bit_state = mSource.GetBitState();
+
+		for( ; ; )
+		{
+			// Check for end of data
+			if( mSource.DoMoreTransitionsExistInCurrentData() == false )
+				break;
+
+			U64 edge = mSource.GetSampleOfNextEdge();
+			if( edge - last_edge >= ( U64( 1 ) << 30 ) )
+			{
+				// A line quiet this long would overflow the fixed point; count whole bits and restart the grid
+				U64 samples_per_bit = std::max<U64>( period >> 32, 1 );
+				mSymbolDecoder.ShiftInBits( bit_state, ( edge - last_edge ) / samples_per_bit, last_edge + samples_per_bit / 2, mSink );
+				boundary = 0;
+				last_edge = edge;
+			}
+			else
+			{
+				S64 elapsed = S64( ( edge - last_edge ) << 32 ) - boundary;
+
+				// Pulses shorter than half a bit are treated as glitches and leave the bit grid alone
+				U64 num_bits = elapsed > 0 ? ( U64( elapsed ) + period / 2 ) / period : 0;
+				if( num_bits > 0 )
+				{
+					S64 first_bit_center = boundary + S64( period / 2 );
+					mSymbolDecoder.ShiftInBits( bit_state, num_bits, last_edge + U64( ( first_bit_center + ( S64( 1 ) << 31 ) ) >> 32 ), mSink );
+
+					// Positive when the edge came late, i.e. the bits are longer than the current period. The grid
+					// moves part of the way from where it predicted the edge towards the edge.
+					S64 phase_error = elapsed - S64( num_bits * period );
+					boundary = ( phase_error >> gain_shift ) - phase_error;
+					last_edge = edge;
+
+					S64 new_period = S64( period ) + ( phase_error >> ( 2 * gain_shift + 1 ) );
+					period = U64( std::max( S64( min_period ), std::min( S64( max_period ), new_period ) ) );
+				}
+			}
+
+			mSource.AdvanceToNextEdge();
+			bit_state = Toggle( bit_state );
+		}
+	}
+
+	// Reports a trailing stretch that never regained lock, at the sample the source stopped on
+	void Finish()
+	{
+		mSymbolDecoder.Finish( mSource.GetSampleNumber(), mSink );
+	}
+
+	const decode8b10bSymbolDecoder& GetSymbolDecoder() const
+	{
+		return mSymbolDecoder;
+	}
+
+protected:
+	// Whole bits in a run of samples, rounded to the nearest
+	U64 GetBitsInRun( U64 samples ) const
+	{
+		if( samples < ( U64( 1 ) << 31 ) )
+			return ( ( samples << 32 ) + mBitPeriod / 2 ) / mBitPeriod;
+
+		// A line quiet this long would overflow the fixed point; whole samples per bit are close enough
+		return samples / std::max<U64>( mBitPeriod >> 32, 1 );
+	}
+
+	Source& mSource;
+	Sink& mSink;
+	U64 mBitPeriod; // samples per bit, 32.32 fixed point
+	decode8b10bSymbolDecoder mSymbolDecoder;
+};
+
+#endif // DECODE8B10B_DECODER_CORE_H
@@ -0,0 +1,268 @@
+#ifndef DECODE8B10B_EDGE_RING_H
+#define DECODE8B10B_EDGE_RING_H
+
+#include <AnalyzerTypes.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+// Carries edge sample numbers from the thread walking a channel to the thread decoding them, so the SDK's
+// channel access and the decoding run side by side. The channel is walked on the analyzer's own worker thread,
+// the only one the SDK promises channel access from, in batches that never wait on the consumer; the consumer
+// runs on a thread of its own and never waits on anything but the ring. One producer, one consumer and no lock:
+// each side owns one index and publishes it every PublishEdges edges, and keeps a copy of the other side's index
+// that it only reloads when the ring looks full or empty, so the shared cache lines move once per batch rather
+// than once per edge. A consumer that has to wait spins briefly, then yields, then sleeps.
+class decode8b10bEdgeRing
+{
+public:
+	enum
+	{
+		Capacity = 1 << 16, // edges, a power of two
+		PublishEdges = 256,
+		BatchEdges = 4096,  // most FillBatch pushes at once
+		IdleSpins = 64,     // waiting this long counts as being idle
+		IdleRepeatSpins = 16
+	};
+
+	// Told on the consumer's thread when it runs out of edges, and again every so often while it waits
+	class IdleListener
+	{
+	public:
+		virtual ~IdleListener() {}
+		virtual void OnConsumerIdle() = 0;
+	};
+
+	decode8b10bEdgeRing()
+	:	mBuffer( Capacity ),
+		mTail( 0 ),
+		mCachedHead( 0 ),
+		mSharedTail( 0 ),
+		mClosed( false ),
+		mCancelled( false ),
+		mHead( 0 ),
+		mCachedTail( 0 ),
+		mSharedHead( 0 ),
+		mIdleListener( nullptr )
+	{
+	}
+
+	// Producer side: pushes source's edges while the ring has room, at most BatchEdges of them, without waiting.
+	// False once source has no more transitions, which closes the ring, or once the consumer has cancelled.
+	// Streaming, the data still to come is waited for by calling again, and the ring stays open. fed tells whether
+	// any edge was pushed.
+	template <class Source>
+	bool FillBatch( Source& source, bool streaming, bool& fed )
+	{
+		fed = false;
+		if( mCancelled.load( std::memory_order_acquire ) )
+			return false;
+
+		mCachedHead = mSharedHead.load( std::memory_order_acquire );
+		U64 room = std::min<U64>( Capacity - ( mTail - mCachedHead ), BatchEdges );
+		for( U64 i = 0; i < room; i++ )
+		{
+			if( !source.DoMoreTransitionsExistInCurrentData() )
+			{
+				if( streaming )
+					break;
+				Close();
+				return false;
+			}
+
+			source.AdvanceToNextEdge();
+			Push( source.GetSampleNumber() );
+			fed = true;
+		}
+
+		mSharedTail.store( mTail, std::memory_order_release );
+		return true;
+	}
+
+	// Hands over the edges still unpublished; Peek returns false once they have been taken
+	void Close()
+	{
+		mSharedTail.store( mTail, std::memory_order_release );
+		mClosed.store( true, std::memory_order_release );
+	}
+
+	// Consumer side
+	void SetIdleListener( IdleListener* listener )
+	{
+		mIdleListener = listener;
+	}
+
+	// The next edge, waiting for one if needed. False when the ring is closed and empty.
+	bool Peek( U64& edge )
+	{
+		if( mHead == mCachedTail && !WaitForEdge() )
+			return false;
+
+		edge = mBuffer[ mHead & ( Capacity - 1 ) ];
+		return true;
+	}
+
+	// Only after a successful Peek
+	void Pop()
+	{
+		mHead++;
+		if( ( mHead & ( PublishEdges - 1 ) ) == 0 )
+			mSharedHead.store( mHead, std::memory_order_release );
+	}
+
+	// Either side gives up: the producer stops filling, and a waiting consumer is released and sees the data end
+	// where it is
+	void Cancel()
+	{
+		mCancelled.store( true, std::memory_order_release );
+	}
+
+	// Spins, then yields, then sleeps as spins grows; also for threads waiting on several rings at once
+	static void Backoff( U32 spins )
+	{
+		if( spins < 64 )
+			return;
+		if( spins < 1024 )
+			std::this_thread::yield();
+		else
+			std::this_thread::sleep_for( std::chrono::microseconds( 100 ) );
+	}
+
+protected:
+	// Only with room in the ring
+	void Push( U64 edge )
+	{
+		mBuffer[ mTail & ( Capacity - 1 ) ] = edge;
+		mTail++;
+		if( ( mTail & ( PublishEdges - 1 ) ) == 0 )
+			mSharedTail.store( mTail, std::memory_order_release );
+	}
+
+	bool WaitForEdge()
+	{
+		// The producer only sees the room handed back
+		mSharedHead.store( mHead, std::memory_order_release );
+		for( U32 spins = 0; ; spins++ )
+		{
+			mCachedTail = mSharedTail.load( std::memory_order_acquire );
+			if( mHead != mCachedTail )
+				return true;
+
+			// The last edges are published before the ring is closed
+			if( mClosed.load( std::memory_order_acquire ) )
+			{
+				mCachedTail = mSharedTail.load( std::memory_order_acquire );
+				return mHead != mCachedTail;
+			}
+			if( mCancelled.load( std::memory_order_acquire ) )
+				return false;
+
+			if( mIdleListener != nullptr && spins >= IdleSpins && ( spins - IdleSpins ) % IdleRepeatSpins == 0 )
+				mIdleListener->OnConsumerIdle();
+			Backoff( spins );
+		}
+	}
+
+	std::vector<U64> mBuffer;
+
+	// Producer; the padding keeps each side's fields off the other's cache line
+	U64 mTail;
+	U64 mCachedHead;
+	std::atomic<U64> mSharedTail;
+	std::atomic<bool> mClosed;
+	std::atomic<bool> mCancelled;
+	char mProducerPadding[ 64 ];
+
+	// Consumer
+	U64 mHead;
+	U64 mCachedTail;
+	std::atomic<U64> mSharedHead;
+	IdleListener* mIdleListener;
+	char mConsumerPadding[ 64 ];
+};
+
+// The consumer end of a decode8b10bEdgeRing as a sample source, with the navigation calls of
+// decode8b10bEdgeSource. Calls that look past the current position wait for the producer, so the data is
+// treated as ending where the producer closed the ring.
+class decode8b10bRingSource
+{
+public:
+	decode8b10bRingSource( decode8b10bEdgeRing& ring, U64 start_sample, BitState start_state )
+	:	mRing( ring ),
+		mSampleNumber( start_sample ),
+		mBitState( start_state )
+	{
+	}
+
+	U64 GetSampleNumber() const
+	{
+		return mSampleNumber;
+	}
+
+	BitState GetBitState() const
+	{
+		return mBitState;
+	}
+
+	U32 AdvanceToAbsPosition( U64 sample_number )
+	{
+		U32 transitions = 0;
+		U64 edge;
+		while( mRing.Peek( edge ) && edge <= sample_number )
+		{
+			mRing.Pop();
+			mBitState = Toggle( mBitState );
+			transitions++;
+		}
+		mSampleNumber = sample_number;
+		return transitions;
+	}
+
+	U32 Advance( U32 num_samples )
+	{
+		return AdvanceToAbsPosition( mSampleNumber + num_samples );
+	}
+
+	// Past the last edge the position stays put
+	void AdvanceToNextEdge()
+	{
+		U64 edge;
+		if( !mRing.Peek( edge ) )
+			return;
+		mRing.Pop();
+		mSampleNumber = edge;
+		mBitState = Toggle( mBitState );
+	}
+
+	U64 GetSampleOfNextEdge()
+	{
+		U64 edge;
+		return mRing.Peek( edge ) ? edge : mSampleNumber;
+	}
+
+	bool WouldAdvancingCauseTransition( U32 num_samples )
+	{
+		return WouldAdvancingToAbsPositionCauseTransition( mSampleNumber + num_samples );
+	}
+
+	bool WouldAdvancingToAbsPositionCauseTransition( U64 sample_number )
+	{
+		U64 edge;
+		return mRing.Peek( edge ) && edge <= sample_number;
+	}
+
+	bool DoMoreTransitionsExistInCurrentData()
+	{
+		U64 edge;
+		return mRing.Peek( edge );
+	}
+
+protected:
+	decode8b10bEdgeRing& mRing;
+	U64 mSampleNumber;
+	BitState mBitState;
+};
+
+#endif // DECODE8B10B_EDGE_RING_H
@@ -0,0 +1,97 @@
+#ifndef DECODE8B10B_EDGE_SOURCE_H
+#define DECODE8B10B_EDGE_SOURCE_H
+
+#include <AnalyzerTypes.h>
+#include <vector>
+
+// A sample source over a list of edge sample numbers, with the navigation calls of AnalyzerChannelData that
+// decode8b10bDecoderCore uses. Lets the decoder run on captures loaded from disk or on synthetic edge streams.
+// The edges must be in increasing order; the data is treated as ending at the last edge.
+class decode8b10bEdgeSource
+{
+public:
+	decode8b10bEdgeSource( const std::vector<U64>& edges, BitState initial_state )
+	:	mEdges( edges ),
+		mNextEdge( 0 ),
+		mEndEdge( edges.size() ),
+		mSampleNumber( 0 ),
+		mBitState( initial_state )
+	{
+	}
+
+	// Only edges first_edge to end_edge - 1; initial_state is the line's state before first_edge
+	decode8b10bEdgeSource( const std::vector<U64>& edges, BitState initial_state, U64 first_edge, U64 end_edge )
+	:	mEdges( edges ),
+		mNextEdge( first_edge ),
+		mEndEdge( end_edge ),
+		mSampleNumber( first_edge > 0 ? edges[ first_edge - 1 ] : 0 ),
+		mBitState( initial_state )
+	{
+	}
+
+	U64 GetSampleNumber() const
+	{
+		return mSampleNumber;
+	}
+
+	BitState GetBitState() const
+	{
+		return mBitState;
+	}
+
+	U32 AdvanceToAbsPosition( U64 sample_number )
+	{
+		U32 transitions = 0;
+		while( mNextEdge < mEndEdge && mEdges[ mNextEdge ] <= sample_number )
+		{
+			mBitState = Toggle( mBitState );
+			mNextEdge++;
+			transitions++;
+		}
+		mSampleNumber = sample_number;
+		return transitions;
+	}
+
+	U32 Advance( U32 num_samples )
+	{
+		return AdvanceToAbsPosition( mSampleNumber + num_samples );
+	}
+
+	// Past the last edge the position stays put, where the SDK would wait for more data
+	void AdvanceToNextEdge()
+	{
+		if( mNextEdge == mEndEdge )
+			return;
+		mSampleNumber = mEdges[ mNextEdge++ ];
+		mBitState = Toggle( mBitState );
+	}
+
+	U64 GetSampleOfNextEdge() const
+	{
+		return mNextEdge < mEndEdge ? mEdges[ mNextEdge ] : mSampleNumber;
+	}
+
+	bool WouldAdvancingCauseTransition( U32 num_samples ) const
+	{
+		return WouldAdvancingToAbsPositionCauseTransition( mSampleNumber + num_samples );
+	}
+
+	bool WouldAdvancingToAbsPositionCauseTransition( U64 sample_number ) const
+	{
+		return mNextEdge < mEndEdge && mEdges[ mNextEdge ] <= sample_number;
+	}
+
+	bool DoMoreTransitionsExistInCurrentData() const
+	{
+		return mNextEdge < mEndEdge;
+	}
+
+protected:
+	const std::vector<U64>& mEdges;
+	U64 mNextEdge;
+	U64 mEndEdge;
+	U64 mSampleNumber;
+	BitState mBitState;
+};
+
+#endif // DECODE8B10B_EDGE_SOURCE_H
@@ -0,0 +1,177 @@
+#include "decode8b10bLaneDeskew.h"
+#include "decode8b10bSymbolDecoder.h"
+#include <algorithm>
+
+decode8b10bLaneDeskew::decode8b10bLaneDeskew()
+{
+	Reset( 1, 0x17C, 10, 0 );
+}
+
+void decode8b10bLaneDeskew::Reset( U32 lane_count, U16 alignment_character, U64 symbol_period, U64 start_sample )
+{
+	mLaneCount = std::max<U32>( 1, std::min<U32>( lane_count, MaxLanes ) );
+	mAlignmentCharacter = alignment_character;
+	mMaxSkew = symbol_period * MaxSkewSymbols;
+	for( U32 lane = 0; lane < MaxLanes; lane++ )
+		mLanes[ lane ].clear();
+
+	mAligned = false;
+	mUnalignedSince = start_sample;
+	mDroppedSymbols = 0;
+	mLastColumnEnd = start_sample;
+}
+
+void decode8b10bLaneDeskew::AddSymbol( U32 lane, const Symbol& symbol, Listener& listener )
+{
+	mLanes[ lane ].push_back( symbol );
+	Process( listener );
+}
+
+void decode8b10bLaneDeskew::LoseLane( U32 lane, U64 sample, Listener& listener )
+{
+	// Whatever the lane still holds was decoded on the way to losing lock
+	while( !mLanes[ lane ].empty() )
+		DropSymbol( lane );
+
+	if( mAligned )
+		DropAlignment( std::max( sample, mLastColumnEnd + 1 ) );
+	Process( listener );
+}
+
+void decode8b10bLaneDeskew::Finish( U64 end_sample, Listener& listener )
+{
+	if( mAligned )
+		return;
+
+	for( U32 lane = 0; lane < mLaneCount; lane++ )
+		mDroppedSymbols += mLanes[ lane ].size();
+
+	Alignment alignment = { mUnalignedSince, std::max( mUnalignedSince, end_sample ), mDroppedSymbols, {}, false };
+	listener.OnAlignment( alignment );
+}
+
+bool decode8b10bLaneDeskew::IsAlignmentCharacter( const Symbol& symbol ) const
+{
+	return symbol.mDecoded == mAlignmentCharacter && symbol.mError == decode8b10bSymbolDecoder::NoSymbolError;
+}
+
+void decode8b10bLaneDeskew::Process( Listener& listener )
+{
+	// Each pass either runs out of symbols or switches between aligned and not
+	for( ; ; )
+	{
+		bool switched = mAligned ? EmitColumns( listener ) : Align( listener );
+		if( !switched )
+			return;
+	}
+}
+
+bool decode8b10bLaneDeskew::EmitColumns( Listener& listener )
+{
+	for( ; ; )
+	{
+		bool complete = true;
+		bool overflow = false;
+		for( U32 lane = 0; lane < mLaneCount; lane++ )
+		{
+			complete = complete && !mLanes[ lane ].empty();
+			overflow = overflow || mLanes[ lane ].size() > MaxBufferedSymbols;
+		}
+
+		if( !complete )
+		{
+			// A lane went quiet while the others carried on
+			if( !overflow )
+				return false;
+			DropAlignment( mLastColumnEnd + 1 );
+			return true;
+		}
+
+		Column column;
+		U32 alignment_lanes = 0;
+		for( U32 lane = 0; lane < mLaneCount; lane++ )
+		{
+			column.mSymbols[ lane ] = mLanes[ lane ].front();
+			mLanes[ lane ].pop_front();
+			if( IsAlignmentCharacter( column.mSymbols[ lane ] ) )
+				alignment_lanes++;
+		}
+		column.mAlignmentError = ( alignment_lanes != 0 && alignment_lanes != mLaneCount );
+		mLastColumnEnd = column.mSymbols[ 0 ].mEnd;
+		listener.OnColumn( column );
+
+		if( column.mAlignmentError )
+		{
+			DropAlignment( mLastColumnEnd + 1 );
+			return true;
+		}
+	}
+}
+
+bool decode8b10bLaneDeskew::Align( Listener& listener )
+{
+	for( ; ; )
+	{
+		// Symbols ahead of a lane's next alignment character can never start a column. Columns take lane 0's
+		// timing, so it also has to be past where the lanes fell out of line.
+		bool dropped = false;
+		for( U32 lane = 0; lane < mLaneCount; lane++ )
+		{
+			while( !mLanes[ lane ].empty() &&
+				   ( !IsAlignmentCharacter( mLanes[ lane ].front() ) || ( lane == 0 && mLanes[ lane ].front().mStart < mUnalignedSince ) ) )
+				DropSymbol( lane );
+
+			// The other lanes have moved on past where this alignment character could have a partner
+			if( mLanes[ lane ].size() > MaxBufferedSymbols )
+			{
+				DropSymbol( lane );
+				dropped = true;
+			}
+		}
+		if( dropped )
+			continue;
+
+		U64 latest = 0;
+		for( U32 lane = 0; lane < mLaneCount; lane++ )
+		{
+			if( mLanes[ lane ].empty() )
+				return false;
+			latest = std::max( latest, mLanes[ lane ].front().mStart );
+		}
+
+		// Every lane is at an alignment character; the ones too early for the latest belong to an earlier column
+		for( U32 lane = 0; lane < mLaneCount; lane++ )
+		{
+			if( mLanes[ lane ].front().mStart + mMaxSkew < latest )
+			{
+				DropSymbol( lane );
+				dropped = true;
+			}
+		}
+		if( dropped )
+			continue;
+
+		U64 reference = mLanes[ 0 ].front().mStart;
+		Alignment alignment = { mUnalignedSince, reference, mDroppedSymbols, {}, true };
+		for( U32 lane = 0; lane < mLaneCount; lane++ )
+			alignment.mSkew[ lane ] = S64( mLanes[ lane ].front().mStart - reference );
+
+		mAligned = true;
+		listener.OnAlignment( alignment );
+		return true;
+	}
+}
+
+void decode8b10bLaneDeskew::DropAlignment( U64 sample )
+{
+	mAligned = false;
+	mUnalignedSince = sample;
+	mDroppedSymbols = 0;
+}
+
+void decode8b10bLaneDeskew::DropSymbol( U32 lane )
+{
+	mLanes[ lane ].pop_front();
+	if( !mAligned )
+		mDroppedSymbols++;
+}
@@ -0,0 +1,85 @@
+#ifndef DECODE8B10B_LANE_DESKEW_H
+#define DECODE8B10B_LANE_DESKEW_H
+
+#include <AnalyzerTypes.h>
+#include "decode8b10bOrderedSetDecoder.h"
+#include <deque>
+
+// Lines up the symbol streams of a multi-lane link (XAUI, JESD204 and the like) into columns, using the alignment
+// character every lane sends in the same column (/A/, K28.3). Each lane's symbols go in as they are decoded;
+// columns come back out through the Listener once every lane has its symbol for them. Alignment characters
+// further apart than MaxSkewSymbols symbol times are not taken to be the same column. Nothing here touches the
+// Analyzer SDK.
+class decode8b10bLaneDeskew
+{
+public:
+	enum
+	{
+		MaxLanes = 4,
+		MaxSkewSymbols = 8 // half the 16 column minimum spacing of XAUI's /A/ columns
+	};
+
+	typedef decode8b10bOrderedSetDecoder::Symbol Symbol;
+
+	struct Column
+	{
+		Symbol mSymbols[ MaxLanes ]; // by lane, the first GetLaneCount() are used
+		bool mAlignmentError;        // the alignment character came on some lanes only; the lanes are lined up again
+	};
+
+	// One stretch spent lining the lanes up, reported when they are aligned or the data ends
+	struct Alignment
+	{
+		U64 mUnalignedSince;
+		U64 mAlignedAt;        // start of lane 0's alignment character
+		U64 mDroppedSymbols;   // symbols, over all lanes, that could not be put in a column
+		S64 mSkew[ MaxLanes ]; // samples each lane's alignment character starts after lane 0's
+		bool mAcquired;        // false when the data ended before the lanes lined up
+	};
+
+	class Listener
+	{
+	public:
+		virtual ~Listener() {}
+		virtual void OnColumn( const Column& column ) = 0;
+		virtual void OnAlignment( const Alignment& alignment ) = 0;
+	};
+
+	decode8b10bLaneDeskew();
+
+	// symbol_period is whole samples per symbol, the unit of the skew limit
+	void Reset( U32 lane_count, U16 alignment_character, U64 symbol_period, U64 start_sample );
+	// Symbols of one lane in time order. Across lanes they must come in order of start sample, so no lane
+	// gets more than the skew limit ahead of the others.
+	void AddSymbol( U32 lane, const Symbol& symbol, Listener& listener );
+	// A lane lost symbol lock; the lanes are lined up again from its next alignment character
+	void LoseLane( U32 lane, U64 sample, Listener& listener );
+	// Reports a trailing stretch the lanes were never lined up in
+	void Finish( U64 end_sample, Listener& listener );
+
+	U32 GetLaneCount() const { return mLaneCount; }
+	bool IsAligned() const { return mAligned; }
+
+protected:
+	bool IsAlignmentCharacter( const Symbol& symbol ) const;
+	void Process( Listener& listener );
+	bool EmitColumns( Listener& listener );
+	bool Align( Listener& listener );
+	void DropAlignment( U64 sample );
+	void DropSymbol( U32 lane );
+
+	// A lane holding more than this is past any column the others could still complete
+	enum { MaxBufferedSymbols = 2 * MaxSkewSymbols + 1 };
+
+	U32 mLaneCount;
+	U16 mAlignmentCharacter;
+	U64 mMaxSkew; // samples
+	std::deque<Symbol> mLanes[ MaxLanes ];
+
+	bool mAligned;
+	U64 mUnalignedSince;
+	U64 mDroppedSymbols;
+	U64 mLastColumnEnd;
+};
+
+#endif // DECODE8B10B_LANE_DESKEW_H
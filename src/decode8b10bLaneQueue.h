@@ -0,0 +1,174 @@
+#ifndef DECODE8B10B_LANE_QUEUE_H
+#define DECODE8B10B_LANE_QUEUE_H
+
+#include <AnalyzerTypes.h>
+#include "decode8b10bSymbolDecoder.h"
+#include "decode8b10bEdgeRing.h"
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <vector>
+
+// Carries one lane's decoder results from the thread decoding it to the analyzer's worker thread, which adds the
+// frames. The producing side is a sink for decode8b10bDecoderCore, and the consumer plays the results back onto a
+// sink of its own with Deliver. Results travel in blocks, so the lock is taken once per block, and the producer
+// waits while MaxBlocks blocks are queued, so a lane that decodes faster than the frames are added does not buffer
+// the whole capture. Hooked up as its ring's idle listener, the queue also hands over a partial block whenever the
+// decoder runs out of edges, so nothing decoded waits on data still to come.
+class decode8b10bLaneQueue : public decode8b10bEdgeRing::IdleListener
+{
+public:
+	enum
+	{
+		BlockEvents = 1024,
+		MaxBlocks = 64
+	};
+
+	enum EventType
+	{
+		SymbolDecodedEvent,
+		SyncReportedEvent,
+		SyncLostEvent
+	};
+
+	struct Event
+	{
+		decode8b10bSymbolDecoder::Symbol mSymbol; // for the sync events only mStart is set, to the sample of the event
+		decode8b10bSymbolDecoder::SyncEvent mSync; // SyncReportedEvent only
+		EventType mType;
+	};
+
+	typedef std::vector<Event> Block;
+
+	decode8b10bLaneQueue()
+	:	mClosed( false ),
+		mCancelled( false ),
+		mIdle( false )
+	{
+		mPending.reserve( BlockEvents );
+	}
+
+	// Producer side
+	void OnSymbolDecoded( const decode8b10bSymbolDecoder::Symbol& symbol )
+	{
+		Event event = {};
+		event.mSymbol = symbol;
+		event.mType = SymbolDecodedEvent;
+		Add( event );
+	}
+
+	void OnSyncEvent( const decode8b10bSymbolDecoder::SyncEvent& sync )
+	{
+		Event event = {};
+		event.mSymbol.mStart = sync.mLockedAt;
+		event.mSync = sync;
+		event.mType = SyncReportedEvent;
+		Add( event );
+	}
+
+	void OnSyncLost( U64 sample )
+	{
+		Event event = {};
+		event.mSymbol.mStart = sample;
+		event.mType = SyncLostEvent;
+		Add( event );
+	}
+
+	// The decoder waits for edges
+	virtual void OnConsumerIdle()
+	{
+		Push();
+		std::lock_guard<std::mutex> lock( mMutex );
+		mIdle = true;
+	}
+
+	// Hands over the last partial block; TryPop finishes once it has been taken
+	void Close()
+	{
+		Push();
+		std::lock_guard<std::mutex> lock( mMutex );
+		mClosed = true;
+		mCondition.notify_all();
+	}
+
+	// Consumer side, without waiting: swaps the next block into block if there is one. finished is set once the
+	// queue is closed and empty, or cancelled.
+	bool TryPop( Block& block, bool& finished )
+	{
+		std::lock_guard<std::mutex> lock( mMutex );
+		finished = mBlocks.empty() && ( mClosed || mCancelled );
+		if( mBlocks.empty() )
+			return false;
+
+		block.swap( mBlocks.front() );
+		mBlocks.pop_front();
+		mCondition.notify_all();
+		return true;
+	}
+
+	// Whether the decoder has run out of edges since the last call, with everything it decoded until then queued
+	bool TakeIdle()
+	{
+		std::lock_guard<std::mutex> lock( mMutex );
+		bool idle = mIdle;
+		mIdle = false;
+		return idle;
+	}
+
+	// Plays an event back onto sink, as the decoder reported it
+	template <class Sink>
+	static void Deliver( const Event& event, Sink& sink )
+	{
+		if( event.mType == SymbolDecodedEvent )
+			sink.OnSymbolDecoded( event.mSymbol );
+		else if( event.mType == SyncReportedEvent )
+			sink.OnSyncEvent( event.mSync );
+		else
+			sink.OnSyncLost( event.mSymbol.mStart );
+	}
+
+	// Either side gives up: a waiting producer is released, the consumer sees the queue finished, and everything
+	// added from then on is dropped
+	void Cancel()
+	{
+		std::lock_guard<std::mutex> lock( mMutex );
+		mCancelled = true;
+		mBlocks.clear();
+		mCondition.notify_all();
+	}
+
+protected:
+	void Add( const Event& event )
+	{
+		mPending.push_back( event );
+		if( mPending.size() == BlockEvents )
+			Push();
+	}
+
+	void Push()
+	{
+		if( mPending.empty() )
+			return;
+
+		std::unique_lock<std::mutex> lock( mMutex );
+		mCondition.wait( lock, [this]() { return mBlocks.size() < MaxBlocks || mCancelled; } );
+		if( !mCancelled )
+		{
+			mBlocks.push_back( Block() );
+			mBlocks.back().swap( mPending );
+			mCondition.notify_all();
+		}
+		mPending.clear();
+		mPending.reserve( BlockEvents );
+	}
+
+	Block mPending; // producer only
+	std::deque<Block> mBlocks;
+	bool mClosed;
+	bool mCancelled;
+	bool mIdle;
+	std::mutex mMutex;
+	std::condition_variable mCondition;
+};
+
+#endif // DECODE8B10B_LANE_QUEUE_H
@@ -0,0 +1,228 @@
+#include "decode8b10bOrderedSetDecoder.h"
+
+// Decoded values of the clause 36 control and ordered set characters
+enum
+{
+	K28_5 = 0x1BC,
+	K23_7 = 0x1F7,
+	K27_7 = 0x1FB,
+	K29_7 = 0x1FD,
+	K30_7 = 0x1FE,
+	D5_6 = 0xC5,
+	D16_2 = 0x50,
+	D21_5 = 0xB5,
+	D2_2 = 0x42
+};
+
+decode8b10bOrderedSetDecoder::decode8b10bOrderedSetDecoder()
+{
+	Reset();
+}
+
+void decode8b10bOrderedSetDecoder::Reset()
+{
+	mState = Between;
+	mPendingCount = 0;
+	mPendingType = IdleSet1;
+	mPacket.mBytes.clear();
+	mPacket.mErrorCount = 0;
+}
+
+void decode8b10bOrderedSetDecoder::AddSymbol( const Symbol& symbol, Listener& listener )
+{
+	bool is_error = ( symbol.mError != 0 );
+
+	switch( mState )
+	{
+	case Between:
+		StartOrderedSet( symbol, listener );
+		break;
+
+	case AfterComma:
+		if( !is_error && ( symbol.mDecoded == D5_6 || symbol.mDecoded == D16_2 ) )
+		{
+			OrderedSet idle = { symbol.mDecoded == D5_6 ? IdleSet1 : IdleSet2, mPending[ 0 ].mStart, symbol.mEnd, 0 };
+			mPendingCount = 0;
+			mState = Between;
+			listener.OnOrderedSet( idle );
+		}
+		else if( !is_error && ( symbol.mDecoded == D21_5 || symbol.mDecoded == D2_2 ) )
+		{
+			mPending[ mPendingCount++ ] = symbol;
+			mPendingType = ( symbol.mDecoded == D21_5 ) ? ConfigSet1 : ConfigSet2;
+			mState = ConfigOctets;
+		}
+		else
+		{
+			// Not an ordered set after all, the comma goes out on its own
+			FlushPending( listener );
+			StartOrderedSet( symbol, listener );
+		}
+		break;
+
+	case ConfigOctets:
+		if( is_error || ( symbol.mDecoded & 0x100 ) )
+		{
+			FlushPending( listener );
+			StartOrderedSet( symbol, listener );
+			break;
+		}
+
+		mPending[ mPendingCount++ ] = symbol;
+		if( mPendingCount == 4 )
+		{
+			OrderedSet config = { mPendingType, mPending[ 0 ].mStart, symbol.mEnd, U16( ( mPending[ 2 ].mDecoded & 0xFF ) | ( ( mPending[ 3 ].mDecoded & 0xFF ) << 8 ) ) };
+			mPendingCount = 0;
+			mState = Between;
+			listener.OnOrderedSet( config );
+		}
+		break;
+
+	case InPacket:
+		if( symbol.mDecoded == K29_7 && !is_error )
+		{
+			mPacket.mEnd = symbol.mEnd;
+			EndPacket( true, listener );
+			break;
+		}
+
+		// Any control character other than /V/ ends the packet early and is decoded on its own
+		if( ( symbol.mDecoded & 0x100 ) && symbol.mDecoded != K30_7 && !is_error )
+		{
+			EndPacket( false, listener );
+			StartOrderedSet( symbol, listener );
+			break;
+		}
+
+		// /V/ and corrupted symbols still take the place of an octet
+		if( is_error || symbol.mDecoded == K30_7 )
+			mPacket.mErrorCount++;
+		mPacket.mBytes.push_back( U8( symbol.mDecoded ) );
+		mPacket.mEnd = symbol.mEnd;
+
+		if( mPacket.mBytes.size() >= MaxPacketBytes )
+			EndPacket( false, listener );
+		break;
+	}
+}
+
+void decode8b10bOrderedSetDecoder::Flush( Listener& listener )
+{
+	if( mState == InPacket )
+		EndPacket( false, listener );
+	else
+		FlushPending( listener );
+
+	mState = Between;
+}
+
+void decode8b10bOrderedSetDecoder::StartOrderedSet( const Symbol& symbol, Listener& listener )
+{
+	if( symbol.mError != 0 )
+	{
+		listener.OnSymbol( symbol );
+		return;
+	}
+
+	switch( symbol.mDecoded )
+	{
+	case K28_5:
+		mPending[ 0 ] = symbol;
+		mPendingCount = 1;
+		mState = AfterComma;
+		break;
+
+	case K27_7:
+		mPacket.mStart = symbol.mStart;
+		mPacket.mEnd = symbol.mEnd;
+		mPacket.mBytes.clear();
+		mPacket.mErrorCount = 0;
+		mState = InPacket;
+		break;
+
+	case K23_7:
+	case K29_7:
+	case K30_7:
+	{
+		OrderedSetType type = ( symbol.mDecoded == K23_7 ) ? CarrierExtend : ( symbol.mDecoded == K29_7 ) ? EndOfPacket : ErrorPropagation;
+		OrderedSet single = { type, symbol.mStart, symbol.mEnd, 0 };
+		listener.OnOrderedSet( single );
+		break;
+	}
+
+	default:
+		listener.OnSymbol( symbol );
+		break;
+	}
+}
+
+void decode8b10bOrderedSetDecoder::EndPacket( bool terminated, Listener& listener )
+{
+	Packet& packet = mPacket;
+	packet.mTerminated = terminated;
+
+	// /S/ replaces the first preamble octet, so 6 more 0x55 and the 0xD5 SFD should follow
+	packet.mPreambleValid = packet.mBytes.size() >= 7 && packet.mBytes[ 6 ] == 0xD5;
+	for( U32 i = 0; i < 6 && packet.mPreambleValid; i++ )
+		packet.mPreambleValid = ( packet.mBytes[ i ] == 0x55 );
+
+	// Without a clean preamble, take the first SFD that follows a preamble octet
+	packet.mFrameOffset = packet.mPreambleValid ? 7 : 0;
+	for( U32 i = 1; packet.mFrameOffset == 0 && i < packet.mBytes.size(); i++ )
+	{
+		if( packet.mBytes[ i ] == 0xD5 && packet.mBytes[ i - 1 ] == 0x55 )
+			packet.mFrameOffset = i + 1;
+	}
+
+	// The FCS is sent least significant octet first
+	packet.mCrcValid = false;
+	U64 frame_length = ( packet.mFrameOffset != 0 ) ? packet.mBytes.size() - packet.mFrameOffset : 0;
+	if( frame_length > 4 )
+	{
+		const U8* frame = &packet.mBytes[ packet.mFrameOffset ];
+		const U8* fcs = frame + frame_length - 4;
+		U32 received = U32( fcs[ 0 ] ) | ( U32( fcs[ 1 ] ) << 8 ) | ( U32( fcs[ 2 ] ) << 16 ) | ( U32( fcs[ 3 ] ) << 24 );
+		packet.mCrcValid = ( Crc32( frame, frame_length - 4 ) == received );
+	}
+
+	mState = Between;
+	listener.OnPacket( packet );
+}
+
+void decode8b10bOrderedSetDecoder::FlushPending( Listener& listener )
+{
+	for( U32 i = 0; i < mPendingCount; i++ )
+		listener.OnSymbol( mPending[ i ] );
+	mPendingCount = 0;
+}
+
+const char* decode8b10bOrderedSetDecoder::GetOrderedSetName( OrderedSetType type )
+{
+	static const char* const names[ NumOrderedSetTypes ] = { "/I1/", "/I2/", "/C1/", "/C2/", "/R/", "/V/", "/T/" };
+	return names[ type ];
+}
+
+U32 decode8b10bOrderedSetDecoder::Crc32( const U8* data, U64 length )
+{
+	// Reflected IEEE 802.3 CRC-32, one table lookup per octet
+	struct Table
+	{
+		U32 mEntries[ 256 ];
+		Table()
+		{
+			for( U32 i = 0; i < 256; i++ )
+			{
+				U32 crc = i;
+				for( int bit = 0; bit < 8; bit++ )
+					crc = ( crc >> 1 ) ^ ( ( crc & 1 ) ? 0xEDB88320 : 0 );
+				mEntries[ i ] = crc;
+			}
+		}
+	};
+	static const Table table;
+
+	U32 crc = 0xFFFFFFFF;
+	for( U64 i = 0; i < length; i++ )
+		crc = ( crc >> 8 ) ^ table.mEntries[ ( crc ^ data[ i ] ) & 0xFF ];
+	return ~crc;
+}
@@ -0,0 +1,95 @@
+#ifndef DECODE8B10B_ORDERED_SET_DECODER_H
+#define DECODE8B10B_ORDERED_SET_DECODER_H
+
+#include <AnalyzerTypes.h>
+#include <vector>
+
+// Groups decoded symbols into 1000BASE-X / SGMII (IEEE 802.3 clause 36) ordered sets and packets.
+// Symbols go in one at a time; everything comes back out through the Listener in time order, either
+// as part of an ordered set or packet, or unchanged when it does not belong to one.
+class decode8b10bOrderedSetDecoder
+{
+public:
+	enum OrderedSetType
+	{
+		IdleSet1,         // /I1/ K28.5 D5.6
+		IdleSet2,         // /I2/ K28.5 D16.2
+		ConfigSet1,       // /C1/ K28.5 D21.5 + 2 config octets
+		ConfigSet2,       // /C2/ K28.5 D2.2 + 2 config octets
+		CarrierExtend,    // /R/ K23.7
+		ErrorPropagation, // /V/ K30.7 outside a packet
+		EndOfPacket,      // /T/ K29.7 outside a packet
+		NumOrderedSetTypes
+	};
+
+	struct Symbol
+	{
+		U64 mStart;
+		U64 mEnd;
+		U16 mCode;    // 10-bit code in standard bit order
+		U16 mDecoded; // bit 8 set for K-characters
+		U8 mError;    // decode8b10bSymbolDecoder::SymbolError
+	};
+
+	struct OrderedSet
+	{
+		OrderedSetType mType;
+		U64 mStart;
+		U64 mEnd;
+		U16 mConfigWord; // /C1/ and /C2/ only, first octet in the low byte
+	};
+
+	struct Packet
+	{
+		U64 mStart; // start of /S/
+		U64 mEnd;   // end of /T/, or of the last symbol when the packet was cut short
+		std::vector<U8> mBytes; // every octet between /S/ and /T/, preamble included
+		U32 mErrorCount;        // symbols with code or disparity errors, and /V/
+		bool mTerminated;       // ended with /T/
+		bool mPreambleValid;    // 6 preamble octets and the SFD right after /S/
+		U32 mFrameOffset;       // first octet after the SFD, 0 when there is none
+		bool mCrcValid;         // Ethernet FCS matches the frame
+	};
+
+	class Listener
+	{
+	public:
+		virtual ~Listener() {}
+		virtual void OnSymbol( const Symbol& symbol ) = 0;
+		virtual void OnOrderedSet( const OrderedSet& ordered_set ) = 0;
+		virtual void OnPacket( const Packet& packet ) = 0;
+	};
+
+	decode8b10bOrderedSetDecoder();
+
+	void Reset();
+	void AddSymbol( const Symbol& symbol, Listener& listener );
+	// Emits anything still pending, e.g. when symbol lock is lost or the capture ends
+	void Flush( Listener& listener );
+
+	static const char* GetOrderedSetName( OrderedSetType type );
+	static U32 Crc32( const U8* data, U64 length );
+
+protected:
+	void StartOrderedSet( const Symbol& symbol, Listener& listener );
+	void EndPacket( bool terminated, Listener& listener );
+	void FlushPending( Listener& listener );
+
+	enum State
+	{
+		Between,      // not inside an ordered set or packet
+		AfterComma,   // K28.5 seen, the next symbol selects the ordered set
+		ConfigOctets, // collecting the two /C/ config octets
+		InPacket
+	};
+
+	enum { MaxPacketBytes = 16384 }; // a lost /T/ must not swallow the rest of the capture
+
+	State mState;
+	Symbol mPending[ 4 ];
+	U32 mPendingCount;
+	OrderedSetType mPendingType;
+	Packet mPacket;
+};
+
+#endif // DECODE8B10B_ORDERED_SET_DECODER_H
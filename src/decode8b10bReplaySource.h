@@ -0,0 +1,103 @@
+#ifndef DECODE8B10B_REPLAY_SOURCE_H
+#define DECODE8B10B_REPLAY_SOURCE_H
+
+#include <AnalyzerTypes.h>
+#include <vector>
+
+// Replays edges already read from a forward-only source, then carries on with the source itself, so the decoder
+// can start from the beginning of a capture whose first edges were read to detect the bit rate. The edges must
+// be the ones the source advanced over, in order from start_sample and start_state, with the source left on the
+// last of them. Same navigation calls as decode8b10bEdgeSource.
+template <class Source>
+class decode8b10bReplaySource
+{
+public:
+	decode8b10bReplaySource( Source& source, const std::vector<U64>& edges, U64 start_sample, BitState start_state )
+	:	mSource( source ),
+		mEdges( edges ),
+		mNextEdge( 0 ),
+		mSampleNumber( start_sample ),
+		mBitState( start_state )
+	{
+	}
+
+	U64 GetSampleNumber()
+	{
+		return Replaying() ? mSampleNumber : mSource.GetSampleNumber();
+	}
+
+	BitState GetBitState()
+	{
+		return Replaying() ? mBitState : mSource.GetBitState();
+	}
+
+	U32 AdvanceToAbsPosition( U64 sample_number )
+	{
+		if( !Replaying() )
+			return mSource.AdvanceToAbsPosition( sample_number );
+
+		U32 transitions = 0;
+		while( Replaying() && mEdges[ mNextEdge ] <= sample_number )
+		{
+			mBitState = Toggle( mBitState );
+			mNextEdge++;
+			transitions++;
+		}
+		mSampleNumber = sample_number;
+
+		// Caught up with the source, which sits on the last replayed edge
+		if( !Replaying() )
+			transitions += mSource.AdvanceToAbsPosition( sample_number );
+		return transitions;
+	}
+
+	U32 Advance( U32 num_samples )
+	{
+		return AdvanceToAbsPosition( GetSampleNumber() + num_samples );
+	}
+
+	void AdvanceToNextEdge()
+	{
+		if( !Replaying() )
+		{
+			mSource.AdvanceToNextEdge();
+			return;
+		}
+		mSampleNumber = mEdges[ mNextEdge++ ];
+		mBitState = Toggle( mBitState );
+	}
+
+	U64 GetSampleOfNextEdge()
+	{
+		return Replaying() ? mEdges[ mNextEdge ] : mSource.GetSampleOfNextEdge();
+	}
+
+	bool WouldAdvancingCauseTransition( U32 num_samples )
+	{
+		return WouldAdvancingToAbsPositionCauseTransition( GetSampleNumber() + num_samples );
+	}
+
+	bool WouldAdvancingToAbsPositionCauseTransition( U64 sample_number )
+	{
+		return Replaying() ? mEdges[ mNextEdge ] <= sample_number : mSource.WouldAdvancingToAbsPositionCauseTransition( sample_number );
+	}
+
+	bool DoMoreTransitionsExistInCurrentData()
+	{
+		return Replaying() || mSource.DoMoreTransitionsExistInCurrentData();
+	}
+
+protected:
+	bool Replaying() const
+	{
+		return mNextEdge < mEdges.size();
+	}
+
+	Source& mSource;
+	const std::vector<U64>& mEdges;
+	U64 mNextEdge;
+	U64 mSampleNumber;
+	BitState mBitState;
+};
+
+#endif // DECODE8B10B_REPLAY_SOURCE_H
@@ -0,0 +1,238 @@
+#include "decode8b10bSegmentDecoder.h"
+#include "decode8b10bDecoderCore.h"
+#include "decode8b10bEdgeSource.h"
+#include "decode8b10bSymbolUtils.h"
+#include <algorithm>
+
+decode8b10bSegmentDecoder::decode8b10bSegmentDecoder( const std::vector<U64>& edges, BitState initial_state )
+:	mEdges( edges ),
+	mInitialState( initial_state ),
+	mSettings(),
+	mSegmentEdges( DefaultSegmentEdges ),
+	mOverlapEdges( 0 ),
+	mConfirmSymbols( MinConfirmSymbols ),
+	mStartTolerance( 0 ),
+	mSegmentCount( 0 ),
+	mBoundaryCuts( 0 ),
+	mNextSegment( 0 ),
+	mReleasedSegment( 0 ),
+	mMaxAhead( MaxSegmentsAhead ),
+	mStopping( false )
+{
+}
+
+decode8b10bSegmentDecoder::~decode8b10bSegmentDecoder()
+{
+	Stop();
+}
+
+void decode8b10bSegmentDecoder::Start( const Settings& settings, U32 num_threads, U64 segment_edges )
+{
+	mSettings = settings;
+
+	// An error older than the loss of sync window can no longer cost lock
+	mConfirmSymbols = std::max<U64>( MinConfirmSymbols, settings.mLossOfSyncErrors != 0 ? settings.mLossOfSyncWindow : 0 );
+	// A symbol holds at most 10 edges, so the overlap always has room to lock and then agree
+	mOverlapEdges = 10 * ( mConfirmSymbols + HuntSymbols );
+	mSegmentEdges = std::max<U64>( segment_edges, 4 * mOverlapEdges );
+	mStartTolerance = settings.mSampling == ClockRecoverySampling ? settings.mBitPeriod >> 33 : 0;
+
+	// Like a sequential decode, nothing is decoded without a second edge to start from
+	U64 num_edges = mEdges.size();
+	mSegmentCount = num_edges < 2 ? 0 : ( num_edges + mSegmentEdges - 1 ) / mSegmentEdges;
+	mBoundaryCuts = 0;
+
+	mSegments.clear();
+	mSegments.resize( mSegmentCount );
+	for( Segment& segment : mSegments )
+	{
+		segment.mHasFinish = false;
+		segment.mDone = false;
+	}
+
+	num_threads = U32( std::max<U64>( 1, std::min<U64>( num_threads, mSegmentCount ) ) );
+	mNextSegment = 0;
+	mReleasedSegment = 0;
+	mMaxAhead = U64( MaxSegmentsAhead ) * num_threads;
+	mStopping = false;
+	for( U32 i = 0; i < num_threads && mSegmentCount > 0; i++ )
+		mThreads.push_back( std::thread( &decode8b10bSegmentDecoder::WorkerThread, this ) );
+}
+
+void decode8b10bSegmentDecoder::Stop()
+{
+	{
+		std::lock_guard<std::mutex> lock( mMutex );
+		mStopping = true;
+		mCondition.notify_all();
+	}
+
+	for( std::thread& thread : mThreads )
+		thread.join();
+	mThreads.clear();
+}
+
+void decode8b10bSegmentDecoder::WorkerThread()
+{
+	for( ; ; )
+	{
+		U64 index;
+		{
+			std::unique_lock<std::mutex> lock( mMutex );
+			mCondition.wait( lock, [this]() { return mStopping || mNextSegment >= mSegmentCount || mNextSegment < mReleasedSegment + mMaxAhead; } );
+			if( mStopping || mNextSegment >= mSegmentCount )
+				return;
+			index = mNextSegment++;
+		}
+
+		DecodeSegment( index );
+
+		std::lock_guard<std::mutex> lock( mMutex );
+		mSegments[ index ].mDone = true;
+		mCondition.notify_all();
+	}
+}
+
+void decode8b10bSegmentDecoder::DecodeSegment( U64 index )
+{
+	U64 first_edge = index * mSegmentEdges;
+	U64 end_edge = std::min<U64>( mEdges.size(), first_edge + mSegmentEdges + mOverlapEdges );
+	first_edge = first_edge > mOverlapEdges ? first_edge - mOverlapEdges : 0;
+
+	// The line toggles at every edge
+	BitState state = ( first_edge & 1 ) ? Toggle( mInitialState ) : mInitialState;
+	decode8b10bEdgeSource source( mEdges, state, first_edge, end_edge );
+
+	Recorder recorder( mSegments[ index ] );
+	decode8b10bDecoderCore<decode8b10bEdgeSource, Recorder> core( source, recorder );
+	core.Start( mSettings.mBitPeriod, mSettings.mMsbFirst, mSettings.mLossOfSyncErrors, mSettings.mLossOfSyncWindow );
+
+	switch( mSettings.mSampling )
+	{
+	case ClockRecoverySampling:
+		core.DecodeClockRecovery( mSettings.mPllGainShift );
+		break;
+	case PerBitSampling:
+		core.DecodeBitByBit();
+		break;
+	case EdgeRunSampling:
+		core.DecodeEdgeRuns();
+		break;
+	}
+
+	recorder.SetFinishing();
+	core.Finish();
+}
+
+const decode8b10bSegmentDecoder::Segment& decode8b10bSegmentDecoder::WaitForSegment( U64 index )
+{
+	std::unique_lock<std::mutex> lock( mMutex );
+	mCondition.wait( lock, [this, index]() { return mSegments[ index ].mDone; } );
+	return mSegments[ index ];
+}
+
+void decode8b10bSegmentDecoder::ReleaseSegment( U64 index )
+{
+	std::vector<Event>().swap( mSegments[ index ].mEvents );
+
+	std::lock_guard<std::mutex> lock( mMutex );
+	mReleasedSegment = index + 1;
+	mCondition.notify_all();
+}
+
+bool decode8b10bSegmentDecoder::IsSameSymbol( const decode8b10bSymbolDecoder::Symbol& a, const decode8b10bSymbolDecoder::Symbol& b ) const
+{
+	U64 start_difference = a.mStart > b.mStart ? a.mStart - b.mStart : b.mStart - a.mStart;
+	return a.mCode == b.mCode && a.mError == b.mError && start_difference <= mStartTolerance;
+}
+
+void decode8b10bSegmentDecoder::Stitch( U64 index, U64 first_event, U64& end_event, U64& next_first_event )
+{
+	const std::vector<Event>& events = mSegments[ index ].mEvents;
+	const std::vector<Event>& next_events = mSegments[ index + 1 ].mEvents;
+
+	// Walk both decodes in time order, counting the symbols they agree on in a row
+	U64 i = first_event;
+	U64 j = 0;
+	U64 run = 0;
+	bool unbalanced = false;
+	while( i < events.size() && j < next_events.size() )
+	{
+		const Event& event = events[ i ];
+		const Event& next_event = next_events[ j ];
+
+		// Locking or losing lock on either side starts the count again
+		if( event.mType != SymbolEvent || next_event.mType != SymbolEvent )
+		{
+			run = 0;
+			unbalanced = false;
+			if( event.mType != SymbolEvent )
+				i++;
+			if( next_event.mType != SymbolEvent )
+				j++;
+			continue;
+		}
+
+		const decode8b10bSymbolDecoder::Symbol& symbol = event.mSymbol;
+		const decode8b10bSymbolDecoder::Symbol& next_symbol = next_event.mSymbol;
+		if( IsSameSymbol( symbol, next_symbol ) )
+		{
+			i++;
+			j++;
+			if( symbol.mError != decode8b10bSymbolDecoder::NoSymbolError )
+			{
+				run = 0;
+				unbalanced = false;
+				continue;
+			}
+
+			// Only a code with more ones than zeros or the reverse settles the running disparity
+			run++;
+			unbalanced = unbalanced || decode8b10bSymbolUtils::LookupSymbol( symbol.mCode ).mOnesCount != 5;
+			if( run >= mConfirmSymbols && unbalanced )
+			{
+				end_event = i;
+				next_first_event = j;
+				return;
+			}
+			continue;
+		}
+
+		// Step past whichever is earlier, or both when they start together but differ
+		run = 0;
+		unbalanced = false;
+		if( symbol.mStart + mStartTolerance < next_symbol.mStart )
+			i++;
+		else if( next_symbol.mStart + mStartTolerance < symbol.mStart )
+			j++;
+		else
+		{
+			i++;
+			j++;
+		}
+	}
+
+	// No agreement: cut where the segments meet
+	mBoundaryCuts++;
+	U64 boundary = mEdges[ ( index + 1 ) * mSegmentEdges ];
+	end_event = first_event;
+	while( end_event < events.size() && GetEventSample( events[ end_event ] ) < boundary )
+		end_event++;
+	next_first_event = 0;
+	while( next_first_event < next_events.size() && GetEventSample( next_events[ next_first_event ] ) < boundary )
+		next_first_event++;
+}
+
+U64 decode8b10bSegmentDecoder::GetEventSample( const Event& event )
+{
+	switch( event.mType )
+	{
+	case SymbolEvent:
+		return event.mSymbol.mStart;
+	case HuntEvent:
+		return event.mSync.mLockedAt;
+	case LockLostEvent:
+		return event.mSample;
+	}
+	return 0;
+}
@@ -0,0 +1,241 @@
+#ifndef DECODE8B10B_SEGMENT_DECODER_H
+#define DECODE8B10B_SEGMENT_DECODER_H
+
+#include <AnalyzerTypes.h>
+#include "decode8b10bSymbolDecoder.h"
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Decodes a capture whose edges are all in memory on several threads at once, for long offline captures. The
+// edges are cut into segments, and each segment is decoded on its own from an overlap before its start to an
+// overlap past its end, hunting for a comma like a fresh decode. Neighbouring decodes are stitched where they
+// agree on a run of error-free symbols at least as long as the loss of sync window and holding an unbalanced
+// code: both are then aligned alike, at the same running disparity, with no error that could still cost lock,
+// so the later decode carries on as a sequential one would. Edge runs and per-bit sampling place bits from the
+// edges alone, so the stitched symbols are exactly a sequential decode's. Clock recovery stitches on symbols
+// within half a bit of each other; the later segment's loop starts from the nominal period, so its symbols may
+// sit a sample away from a sequential decode's for a while. An overlap holding no such run, a stretch that never
+// stays locked, is cut at the segment boundary instead.
+//
+// Segments are handed out to the threads in order, and no thread gets further than MaxSegmentsAhead segments
+// past the one being passed to the sink, so the results held in memory stay bounded however long the capture.
+// Nothing here touches the Analyzer SDK.
+class decode8b10bSegmentDecoder
+{
+public:
+	enum
+	{
+		DefaultSegmentEdges = 1 << 20,
+		MinConfirmSymbols = 32, // agreement needed when loss of sync is off or its window is shorter
+		HuntSymbols = 4096,     // allowance for a fresh decode to find its first comma
+		MaxSegmentsAhead = 4    // per thread
+	};
+
+	enum Sampling
+	{
+		EdgeRunSampling,
+		PerBitSampling,
+		ClockRecoverySampling
+	};
+
+	struct Settings
+	{
+		U64 mBitPeriod; // samples per bit, 32.32 fixed point
+		bool mMsbFirst;
+		U32 mLossOfSyncErrors;
+		U32 mLossOfSyncWindow;
+		Sampling mSampling;
+		U32 mPllGainShift;
+	};
+
+	// edges and initial_state as for decode8b10bEdgeSource; the edges must outlive the decoder
+	decode8b10bSegmentDecoder( const std::vector<U64>& edges, BitState initial_state );
+	~decode8b10bSegmentDecoder();
+
+	// Results reach the sink on the calling thread, in capture order, with the same calls as from
+	// decode8b10bDecoderCore. segment_edges is raised to several overlaps when shorter.
+	template <class Sink>
+	void Decode( const Settings& settings, U32 num_threads, Sink& sink, U64 segment_edges = DefaultSegmentEdges );
+	// Reports a trailing stretch that never regained lock, like decode8b10bDecoderCore::Finish
+	template <class Sink>
+	void Finish( Sink& sink );
+
+	U64 GetSegmentCount() const { return mSegmentCount; }
+	// Segment boundaries no agreeing run was found around
+	U64 GetBoundaryCuts() const { return mBoundaryCuts; }
+
+protected:
+	enum EventType
+	{
+		SymbolEvent,
+		HuntEvent,
+		LockLostEvent
+	};
+
+	struct Event
+	{
+		EventType mType;
+		union
+		{
+			decode8b10bSymbolDecoder::Symbol mSymbol;
+			decode8b10bSymbolDecoder::SyncEvent mSync;
+			U64 mSample; // lock lost
+		};
+	};
+
+	struct Segment
+	{
+		std::vector<Event> mEvents;
+		bool mHasFinish; // the decode ended without lock
+		decode8b10bSymbolDecoder::SyncEvent mFinish;
+		bool mDone;
+	};
+
+	// Sink for one segment's decode
+	class Recorder
+	{
+	public:
+		Recorder( Segment& segment )
+		:	mSegment( segment )
+		{
+		}
+
+		void OnSymbolDecoded( const decode8b10bSymbolDecoder::Symbol& symbol )
+		{
+			Event event;
+			event.mType = SymbolEvent;
+			event.mSymbol = symbol;
+			mSegment.mEvents.push_back( event );
+		}
+
+		void OnSyncEvent( const decode8b10bSymbolDecoder::SyncEvent& sync )
+		{
+			if( mFinishing )
+			{
+				mSegment.mHasFinish = true;
+				mSegment.mFinish = sync;
+				return;
+			}
+
+			Event event;
+			event.mType = HuntEvent;
+			event.mSync = sync;
+			mSegment.mEvents.push_back( event );
+		}
+
+		void OnSyncLost( U64 sample )
+		{
+			Event event;
+			event.mType = LockLostEvent;
+			event.mSample = sample;
+			mSegment.mEvents.push_back( event );
+		}
+
+		void SetFinishing() { mFinishing = true; }
+
+	protected:
+		Segment& mSegment;
+		bool mFinishing = false;
+	};
+
+	void Start( const Settings& settings, U32 num_threads, U64 segment_edges );
+	void Stop();
+	void WorkerThread();
+	void DecodeSegment( U64 index );
+	const Segment& WaitForSegment( U64 index );
+	void ReleaseSegment( U64 index );
+	// Where segment index's events, read from first_event on, hand over to segment index + 1's
+	void Stitch( U64 index, U64 first_event, U64& end_event, U64& next_first_event );
+	bool IsSameSymbol( const decode8b10bSymbolDecoder::Symbol& a, const decode8b10bSymbolDecoder::Symbol& b ) const;
+	static U64 GetEventSample( const Event& event );
+
+	template <class Sink>
+	static void Replay( const Event& event, Sink& sink );
+
+	const std::vector<U64>& mEdges;
+	BitState mInitialState;
+	Settings mSettings;
+	U64 mSegmentEdges;
+	U64 mOverlapEdges;
+	U64 mConfirmSymbols;
+	U64 mStartTolerance; // samples two decodes' symbol starts may differ by and still agree
+	U64 mSegmentCount;
+	U64 mBoundaryCuts;
+
+	// Shared with the workers
+	std::vector<Segment> mSegments;
+	U64 mNextSegment;     // next one a worker takes
+	U64 mReleasedSegment; // segments before this have gone to the sink
+	U64 mMaxAhead;
+	bool mStopping;
+	std::mutex mMutex;
+	std::condition_variable mCondition;
+	std::vector<std::thread> mThreads;
+};
+
+template <class Sink>
+void decode8b10bSegmentDecoder::Decode( const Settings& settings, U32 num_threads, Sink& sink, U64 segment_edges )
+{
+	Start( settings, num_threads, segment_edges );
+
+	try
+	{
+		U64 first_event = 0;
+		for( U64 index = 0; index < mSegmentCount; index++ )
+		{
+			const Segment& segment = WaitForSegment( index );
+			U64 end_event = segment.mEvents.size();
+			U64 next_first_event = 0;
+			if( index + 1 < mSegmentCount )
+			{
+				WaitForSegment( index + 1 );
+				Stitch( index, first_event, end_event, next_first_event );
+			}
+
+			for( U64 i = first_event; i < end_event; i++ )
+				Replay( segment.mEvents[ i ], sink );
+
+			// The last segment's trailing stretch stays for Finish
+			if( index + 1 < mSegmentCount )
+				ReleaseSegment( index );
+			first_event = next_first_event;
+		}
+	}
+	catch( ... )
+	{
+		Stop();
+		throw;
+	}
+
+	Stop();
+}
+
+template <class Sink>
+void decode8b10bSegmentDecoder::Finish( Sink& sink )
+{
+	if( mSegmentCount == 0 || !mSegments.back().mHasFinish )
+		return;
+
+	sink.OnSyncEvent( mSegments.back().mFinish );
+}
+
+template <class Sink>
+void decode8b10bSegmentDecoder::Replay( const Event& event, Sink& sink )
+{
+	switch( event.mType )
+	{
+	case SymbolEvent:
+		sink.OnSymbolDecoded( event.mSymbol );
+		break;
+	case HuntEvent:
+		sink.OnSyncEvent( event.mSync );
+		break;
+	case LockLostEvent:
+		sink.OnSyncLost( event.mSample );
+		break;
+	}
+}
+
+#endif // DECODE8B10B_SEGMENT_DECODER_H
@@ -1,11 +1,34 @@
 #include "decode8b10bSimulationDataGenerator.h"
 #include "decode8b10bAnalyzerSettings.h"
+#include "decode8b10bSymbolUtils.h"
+#include "decode8b10bOrderedSetDecoder.h"
+#include "decode8b10bSymbolDecoder.h"
 
 #include <AnalyzerHelpers.h>
 
+// Decoded values of the characters the generator sends
+enum
+{
+	K28_5 = 0x1BC, // comma, first character of every idle ordered set
+	K23_7 = 0x1F7, // /R/ carrier extend
+	K27_7 = 0x1FB, // /S/ start of packet
+	K29_7 = 0x1FD, // /T/ end of packet
+	D5_6 = 0xC5,
+	D16_2 = 0x50
+};
+
 decode8b10bSimulationDataGenerator::decode8b10bSimulationDataGenerator()
-:	mSerialText( "My first analyzer, woo hoo!" ),
-	mStringIndex( 0 )
+:	mPendingIndex( 0 ),
+	mRunningDisparity( 0 ),
+	mPrbsState( 0x7F ),
+	mRandomState( 0x8b10b ),
+	mSymbolsSent( 0 ),
+	mErrorsInjected( 0 ),
+	mPendingError( NoInjectedError ),
+	mBitPeriod( U64( 1 ) << 32 ),
+	mSampleFraction( 0 ),
+	mRunLevel( BIT_LOW ),
+	mRunBits( 0 )
 {
 }
 
@@ -20,52 +43,261 @@ void decode8b10bSimulationDataGenerator::Initialize( U32 simulation_sample_rate,
 
 	mSerialSimulationData.SetChannel( mSettings->mInputChannel );
 	mSerialSimulationData.SetSampleRate( simulation_sample_rate );
-	mSerialSimulationData.SetInitialBitState( BIT_HIGH );
+	mSerialSimulationData.SetInitialBitState( BIT_LOW );
+	mRunLevel = BIT_LOW;
+	mRunBits = 0;
+
+	// Fractional, so each run ends on the nearest sample to where the bit clock puts it
+	mBitPeriod = decode8b10bSymbolDecoder::GetBitPeriod( mSimulationSampleRateHz, mSettings->mBitRate );
+	mSampleFraction = 0;
+
+	// Waveforms of every code and of the idle ordered set are worked out once, sending a symbol is then one
+	// Transition and Advance per run of equal bits instead of per bit
+	bool msb_first = ( mSettings->mBitOrder == decode8b10bAnalyzerSettings::MsbFirst );
+	mSymbolRuns.resize( 1024 );
+	for( U16 code = 0; code < 1024; code++ )
+		BuildBitRuns( msb_first ? decode8b10bSymbolUtils::ReverseBits10( code ) : code, 10, mSymbolRuns[ code ] );
+
+	U8 running_disparity = 0;
+	U16 comma = decode8b10bSymbolUtils::EncodeSymbol( K28_5, running_disparity );
+	U16 idle = decode8b10bSymbolUtils::EncodeSymbol( D16_2, running_disparity );
+	if( msb_first )
+	{
+		comma = decode8b10bSymbolUtils::ReverseBits10( comma );
+		idle = decode8b10bSymbolUtils::ReverseBits10( idle );
+	}
+	BuildBitRuns( ( U32( comma ) << 10 ) | idle, 20, mIdleRuns );
 }
 
 U32 decode8b10bSimulationDataGenerator::GenerateSimulationData( U64 largest_sample_requested, U32 sample_rate, SimulationChannelDescriptor** simulation_channel )
 {
 	U64 adjusted_largest_sample_requested = AnalyzerHelpers::AdjustSimulationTargetSample( largest_sample_requested, sample_rate, mSimulationSampleRateHz );
 
-	while( mSerialSimulationData.GetCurrentSampleNumber() < adjusted_largest_sample_requested )
+	while( mSerialSimulationData.GetCurrentSampleNumber() + ( ( U64( mRunBits ) * mBitPeriod ) >> 32 ) < adjusted_largest_sample_requested )
 	{
-		CreateSerialByte();
+		if( mPendingIndex == mPendingSymbols.size() )
+			CreateTraffic();
+
+		if( !CreateIdleOrderedSet() )
+			CreateSymbol( mPendingSymbols[ mPendingIndex++ ] );
 	}
+	FlushRun();
 
 	*simulation_channel = &mSerialSimulationData;
 	return 1;
 }
 
-void decode8b10bSimulationDataGenerator::CreateSerialByte()
+void decode8b10bSimulationDataGenerator::CreateTraffic()
+{
+	mPendingSymbols.clear();
+	mPendingIndex = 0;
+
+	switch( mSettings->mSimulationTraffic )
+	{
+	case decode8b10bAnalyzerSettings::IdleTraffic:
+		QueueIdle( 64 );
+		break;
+
+	case decode8b10bAnalyzerSettings::PacketTraffic:
+		// Inter-packet gap of at least 12 octet times
+		QueueIdle( 6 + NextRandom() % 8 );
+		QueuePacket();
+		break;
+
+	case decode8b10bAnalyzerSettings::PrbsTraffic:
+		mPendingSymbols.push_back( K28_5 );
+		for( U32 i = 0; i < 15; i++ )
+			mPendingSymbols.push_back( NextPrbsOctet() );
+		break;
+	}
+}
+
+void decode8b10bSimulationDataGenerator::QueueIdle( U32 ordered_sets )
+{
+	for( U32 i = 0; i < ordered_sets; i++ )
+	{
+		mPendingSymbols.push_back( K28_5 );
+		mPendingSymbols.push_back( IdleSecondSymbol );
+	}
+}
+
+void decode8b10bSimulationDataGenerator::QueuePacket()
+{
+	// Broadcast frame from a locally administered address, with the local experimental EtherType
+	std::vector<U8> frame = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x8B, 0x10, 0x88, 0xB5 };
+	U32 payload_length = 46 + NextRandom() % 256;
+	for( U32 i = 0; i < payload_length; i++ )
+		frame.push_back( NextPrbsOctet() );
+
+	U32 fcs = decode8b10bOrderedSetDecoder::Crc32( frame.data(), frame.size() );
+	for( U32 i = 0; i < 4; i++ )
+		frame.push_back( U8( fcs >> ( 8 * i ) ) );
+
+	// /S/ takes the place of the first preamble octet
+	U64 packet_start = mPendingSymbols.size();
+	mPendingSymbols.push_back( K27_7 );
+	for( U32 i = 0; i < 6; i++ )
+		mPendingSymbols.push_back( 0x55 );
+	mPendingSymbols.push_back( 0xD5 );
+	mPendingSymbols.insert( mPendingSymbols.end(), frame.begin(), frame.end() );
+
+	// /T/R/, plus a second /R/ so the next ordered set starts on an even symbol
+	mPendingSymbols.push_back( K29_7 );
+	mPendingSymbols.push_back( K23_7 );
+	if( ( mPendingSymbols.size() - packet_start ) & 1 )
+		mPendingSymbols.push_back( K23_7 );
+}
+
+U8 decode8b10bSimulationDataGenerator::NextPrbsOctet()
+{
+	// PRBS-7, x^7 + x^6 + 1
+	U8 octet = 0;
+	for( U32 bit = 0; bit < 8; bit++ )
+	{
+		U8 feedback = ( ( mPrbsState >> 6 ) ^ ( mPrbsState >> 5 ) ) & 1;
+		mPrbsState = U8( ( ( mPrbsState << 1 ) | feedback ) & 0x7F );
+		octet |= feedback << bit;
+	}
+	return octet;
+}
+
+U32 decode8b10bSimulationDataGenerator::NextRandom()
+{
+	mRandomState = mRandomState * 1664525 + 1013904223;
+	return mRandomState >> 8;
+}
+
+bool decode8b10bSimulationDataGenerator::CreateIdleOrderedSet()
 {
-	U32 samples_per_bit = mSimulationSampleRateHz / mSettings->mBitRate;
+	// Only an /I2/ about to be sent at RD-, with no error due on either symbol, can use the precomputed waveform
+	if( mPendingIndex + 1 >= mPendingSymbols.size() || mPendingSymbols[ mPendingIndex ] != K28_5 || mPendingSymbols[ mPendingIndex + 1 ] != IdleSecondSymbol )
+		return false;
+	if( mRunningDisparity != 0 || mPendingError != NoInjectedError )
+		return false;
+
+	U32 error_interval = mSettings->mSimulationErrorInterval;
+	if( error_interval != 0 && ( ( mSymbolsSent + 1 ) % error_interval == 0 || ( mSymbolsSent + 2 ) % error_interval == 0 ) )
+		return false;
+
+	// K28.5 takes the disparity to RD+ and D16.2 brings it back
+	CreateRuns( mIdleRuns );
+	mSymbolsSent += 2;
+	mPendingIndex += 2;
+	return true;
+}
+
+void decode8b10bSimulationDataGenerator::CreateSymbol( U16 decoded )
+{
+	// The idle ordered set that brings the running disparity back to RD-
+	if( decoded == IdleSecondSymbol )
+		decoded = ( mRunningDisparity == 1 ) ? D16_2 : D5_6;
+
+	U32 error_interval = mSettings->mSimulationErrorInterval;
+	mSymbolsSent++;
+	if( error_interval != 0 && mSymbolsSent % error_interval == 0 )
+		mPendingError = InjectedError( 1 + mErrorsInjected++ % ( NumInjectedErrors - 1 ) );
+
+	U8 encode_disparity = mRunningDisparity;
+	U16 code = decode8b10bSymbolUtils::EncodeSymbol( decoded, mRunningDisparity );
+	U32 bit_count = 10;
+
+	switch( mPendingError )
+	{
+	case CodeError:
+		// Flip the first bit, starting from a random one, that turns the symbol into an invalid code
+		for( U32 i = 0, first = NextRandom() % 10; i < 10; i++ )
+		{
+			U16 corrupted = code ^ U16( 1 << ( ( first + i ) % 10 ) );
+			if( !decode8b10bSymbolUtils::IsValid( decode8b10bSymbolUtils::LookupSymbol( corrupted ) ) )
+			{
+				code = corrupted;
+				break;
+			}
+		}
+		mPendingError = NoInjectedError;
+		break;
+
+	case DisparityError:
+	{
+		// Balanced symbols never show a disparity error, wait for an unbalanced one
+		if( decode8b10bSymbolUtils::LookupSymbol( code ).mOnesCount != 5 )
+		{
+			U8 wrong_disparity = encode_disparity ^ 1;
+			code = decode8b10bSymbolUtils::EncodeSymbol( decoded, wrong_disparity );
+			mPendingError = NoInjectedError;
+		}
+		break;
+	}
 
-	U8 byte = mSerialText[ mStringIndex ];
-	mStringIndex++;
-	if( mStringIndex == mSerialText.size() )
-		mStringIndex = 0;
+	case BitSlip:
+		bit_count = 9;
+		mPendingError = NoInjectedError;
+		break;
 
-	//we're currenty high
-	//let's move forward a little
-	mSerialSimulationData.Advance( samples_per_bit * 10 );
+	default:
+		break;
+	}
 
-	mSerialSimulationData.Transition();  //low-going edge for start bit
-	mSerialSimulationData.Advance( samples_per_bit );  //add start bit time
+	if( bit_count == 10 )
+	{
+		CreateRuns( mSymbolRuns[ code ] );
+	}
+	else
+	{
+		// A slipped symbol loses its last bit on the wire
+		bool msb_first = ( mSettings->mBitOrder == decode8b10bAnalyzerSettings::MsbFirst );
+		U32 wire_code = msb_first ? decode8b10bSymbolUtils::ReverseBits10( code ) : code;
+		BitRuns runs;
+		BuildBitRuns( wire_code >> ( 10 - bit_count ), bit_count, runs );
+		CreateRuns( runs );
+	}
+}
 
-	U8 mask = 0x1 << 7;
-	for( U32 i=0; i<8; i++ )
+void decode8b10bSimulationDataGenerator::BuildBitRuns( U32 bits, U32 bit_count, BitRuns& runs ) const
+{
+	// The first bit on the wire is the top one of bit_count
+	runs.mFirstBit = U8( ( bits >> ( bit_count - 1 ) ) & 1 );
+	runs.mRunCount = 0;
+	U8 run = 0;
+	U32 level = runs.mFirstBit;
+	for( U32 i = 0; i < bit_count; i++ )
 	{
-		if( ( byte & mask ) != 0 )
-			mSerialSimulationData.TransitionIfNeeded( BIT_HIGH );
-		else
-			mSerialSimulationData.TransitionIfNeeded( BIT_LOW );
+		U32 bit = ( bits >> ( bit_count - 1 - i ) ) & 1;
+		if( bit != level )
+		{
+			runs.mRuns[ runs.mRunCount++ ] = run;
+			run = 0;
+			level = bit;
+		}
+		run++;
+	}
+	runs.mRuns[ runs.mRunCount++ ] = run;
+}
 
-		mSerialSimulationData.Advance( samples_per_bit );
-		mask = mask >> 1;
+void decode8b10bSimulationDataGenerator::CreateRuns( const BitRuns& runs )
+{
+	// The last run of one symbol and the first of the next merge when they are at the same level
+	BitState level = runs.mFirstBit ? BIT_HIGH : BIT_LOW;
+	for( U32 i = 0; i < runs.mRunCount; i++ )
+	{
+		if( level != mRunLevel )
+		{
+			FlushRun();
+			mSerialSimulationData.Transition();
+			mRunLevel = level;
+		}
+		mRunBits += runs.mRuns[ i ];
+		level = Toggle( level );
 	}
+}
 
-	mSerialSimulationData.TransitionIfNeeded( BIT_HIGH ); //we need to end high
+void decode8b10bSimulationDataGenerator::FlushRun()
+{
+	if( mRunBits == 0 )
+		return;
 
-	//lets pad the end a bit for the stop bit:
-	mSerialSimulationData.Advance( samples_per_bit );
+	U64 run_samples = U64( mRunBits ) * mBitPeriod + mSampleFraction;
+	mSerialSimulationData.Advance( U32( run_samples >> 32 ) );
+	mSampleFraction = run_samples & 0xFFFFFFFF;
+	mRunBits = 0;
 }
@@ -2,7 +2,7 @@
 #define DECODE8B10B_SIMULATION_DATA_GENERATOR
 
 #include <SimulationChannelDescriptor.h>
-#include <string>
+#include <vector>
 class decode8b10bAnalyzerSettings;
 
 class decode8b10bSimulationDataGenerator
@@ -19,11 +19,56 @@ protected:
 	U32 mSimulationSampleRateHz;
 
 protected:
-	void CreateSerialByte();
-	std::string mSerialText;
-	U32 mStringIndex;
+	// Queued in place of the second idle character, resolved to D5.6 (/I1/) or D16.2 (/I2/) when it is sent
+	enum { IdleSecondSymbol = 0x200 };
+
+	enum InjectedError
+	{
+		NoInjectedError,
+		CodeError,      // one bit of a symbol flipped into an invalid code
+		DisparityError, // an unbalanced symbol sent from the wrong disparity column
+		BitSlip,        // one bit of a symbol dropped, the decoder has to realign
+		NumInjectedErrors
+	};
+
+	void CreateTraffic();
+	void QueueIdle( U32 ordered_sets );
+	void QueuePacket();
+	U8 NextPrbsOctet();
+	U32 NextRandom();
+
+	// Alternating runs of equal bits, in the order they go out on the wire
+	struct BitRuns
+	{
+		U8 mFirstBit;
+		U8 mRunCount;
+		U8 mRuns[ 20 ]; // run lengths in bits
+	};
+
+	bool CreateIdleOrderedSet();
+	void CreateSymbol( U16 decoded );
+	void BuildBitRuns( U32 bits, U32 bit_count, BitRuns& runs ) const;
+	void CreateRuns( const BitRuns& runs );
+	void FlushRun();
+
+	std::vector<U16> mPendingSymbols; // decoded values, bit 8 set for K-characters
+	U32 mPendingIndex;
+	U8 mRunningDisparity;
+	U8 mPrbsState;
+	U32 mRandomState;
+	U64 mSymbolsSent;
+	U32 mErrorsInjected;
+	InjectedError mPendingError;
+
+	//waveform state:
+	std::vector<BitRuns> mSymbolRuns; // indexed by 10-bit code
+	BitRuns mIdleRuns;                // the /I2/ ordered set that repeats while idle at RD-
+	U64 mBitPeriod;                   // samples per bit, 32.32 fixed point
+	U64 mSampleFraction;              // fraction of a sample the waveform lags the bit clock by, 32.32
+	BitState mRunLevel;
+	U32 mRunBits;                     // bits at mRunLevel not yet advanced over
 
 	SimulationChannelDescriptor mSerialSimulationData;
 
 };
-#endif //DECODE8B10B_SIMULATION_DATA_GENERATOR
\ No newline at end of file
+#endif //DECODE8B10B_SIMULATION_DATA_GENERATOR
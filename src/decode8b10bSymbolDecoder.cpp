@@ -0,0 +1,74 @@
+#include "decode8b10bSymbolDecoder.h"
+
+decode8b10bSymbolDecoder::decode8b10bSymbolDecoder()
+{
+	Reset( U64( 1 ) << 32, false, 0, 1, 0 );
+}
+
+void decode8b10bSymbolDecoder::Reset( U64 bit_period, bool msb_first, U32 loss_of_sync_errors, U32 loss_of_sync_window, U64 start_sample )
+{
+	mBitPeriod = bit_period;
+	mLossOfSyncErrors = loss_of_sync_errors;
+	mLossOfSyncWindow = loss_of_sync_window;
+
+	// Symbols are always assembled in standard bit order, MSB-first links only change how bits enter the window
+	mMsbFirst = msb_first;
+
+	// Hunt for a comma to establish symbol alignment
+	mHuntBits = 0;
+	mHuntBitCount = 0;
+	mHuntBitTotal = 0;
+	mHuntRunCount = 0;
+	mSlidingWindow = 0;
+	mBitsInWindow = 0;
+	mRunningDisparity = 0;
+	mSynchronized = false;
+	mFirstSymbol = true;
+
+	// Loss of sync tracking
+	mRecentErrors.assign( mLossOfSyncErrors, 0 );
+	mErrorCount = 0;
+	mSymbolIndex = 0;
+	mLockLossCause = LossAtStart;
+	mHuntStartBit = 0;
+	mUnlockedSince = start_sample;
+}
+
+const char* decode8b10bSymbolDecoder::GetSymbolErrorText( SymbolError error )
+{
+	static const char* const error_text[] = {
+		"",
+		"Disparity mismatch: too many ones",
+		"Disparity mismatch: too many zeros",
+		"Invalid code"
+	};
+	return error_text[ error ];
+}
+
+U64 decode8b10bSymbolDecoder::HuntBitCenter( U64 bit_index )
+{
+	// Find the run the bit belongs to, newest first
+	for( U32 i = 1; i <= NumHuntRuns && i <= mHuntRunCount; i++ )
+	{
+		const HuntRun& run = mHuntRuns[ ( mHuntRunCount - i ) % NumHuntRuns ];
+		if( run.mFirstBit <= bit_index )
+			return run.mFirstBitCenter + GetSamplesForBits( bit_index - run.mFirstBit );
+	}
+	return 0;
+}
+
+bool decode8b10bSymbolDecoder::TrackSyncErrors( bool symbol_error )
+{
+	U64 symbol_index = mSymbolIndex++;
+	U32 max_errors = mLossOfSyncErrors;
+	if( !symbol_error || max_errors == 0 )
+		return false;
+
+	// Lock is lost when the last max_errors errors all fall within the window
+	mRecentErrors[ mErrorCount++ % max_errors ] = symbol_index;
+	if( mErrorCount < max_errors )
+		return false;
+
+	U64 oldest_error = mRecentErrors[ mErrorCount % max_errors ];
+	return ( symbol_index - oldest_error ) < mLossOfSyncWindow;
+}
@@ -0,0 +1,303 @@
+#ifndef DECODE8B10B_SYMBOL_DECODER_H
+#define DECODE8B10B_SYMBOL_DECODER_H
+
+#include <AnalyzerTypes.h>
+#include "decode8b10bOrderedSetDecoder.h"
+#include "decode8b10bSymbolUtils.h"
+#include <algorithm>
+#include <vector>
+
+// Turns a recovered bitstream into 8b/10b symbols: comma hunt and alignment, running disparity checks and
+// loss of sync. Bits go in as runs of equal bits with the sample at the center of the first one; the later bits
+// of a run are placed from it with a fractional bit period, so timing is exact at any oversampling. Results come
+// back through a sink: any type with the three Listener calls. Sinks deriving from Listener get virtual
+// dispatch, concrete sinks get the calls inlined. Nothing here touches the Analyzer SDK, so the plugin and
+// offline tools share it.
+class decode8b10bSymbolDecoder
+{
+public:
+	// Per-symbol error, stored in Symbol::mError
+	enum SymbolError
+	{
+		NoSymbolError,
+		TooManyOnesError,
+		TooManyZerosError,
+		InvalidCodeError
+	};
+
+	enum LockLossCause
+	{
+		LossAtStart,
+		LossByErrors
+	};
+
+	// One stretch spent without symbol lock, reported when lock is found or the data ends
+	struct SyncEvent
+	{
+		U64 mUnlockedSince;
+		U64 mLockedAt;
+		U64 mHuntedBits;
+		LockLossCause mCause;
+		bool mAcquired; // false when the data ended before a comma was found
+	};
+
+	typedef decode8b10bOrderedSetDecoder::Symbol Symbol;
+
+	class Listener
+	{
+	public:
+		virtual ~Listener() {}
+		virtual void OnSymbolDecoded( const Symbol& symbol ) = 0;
+		virtual void OnSyncEvent( const SyncEvent& sync ) = 0;
+		// Called after the symbol that cost the lock, before hunting starts again
+		virtual void OnSyncLost( U64 sample ) = 0;
+	};
+
+	decode8b10bSymbolDecoder();
+
+	// Samples per bit in 32.32 fixed point, exact for bit rates below 2^32 and up to 2^32 samples per bit
+	static U64 GetBitPeriod( U64 sample_rate, U64 bit_rate )
+	{
+		return ( ( sample_rate / bit_rate ) << 32 ) + ( ( sample_rate % bit_rate ) << 32 ) / bit_rate;
+	}
+
+	// bit_period is samples per bit in 32.32 fixed point
+	void Reset( U64 bit_period, bool msb_first, U32 loss_of_sync_errors, U32 loss_of_sync_window, U64 start_sample );
+	template <class Sink>
+	void ShiftInBits( BitState bit_state, U64 num_bits, U64 first_bit_center, Sink& sink );
+	// Reports a trailing stretch that never regained lock
+	template <class Sink>
+	void Finish( U64 end_sample, Sink& sink );
+
+	bool IsSynchronized() const { return mSynchronized; }
+
+	static const char* GetSymbolErrorText( SymbolError error );
+
+protected:
+	template <class Sink>
+	void HuntForComma( Sink& sink );
+	U64 HuntBitCenter( U64 bit_index );
+	template <class Sink>
+	U64 ShiftInSymbolBits( U16 bit, U64 num_bits, U64 first_bit_center, Sink& sink );
+	template <class Sink>
+	void ProcessSymbol( U64 first_bit_center, U64 last_bit_center, Sink& sink );
+	bool TrackSyncErrors( bool symbol_error );
+
+	// Whole samples spanned by num_bits bits, rounded down
+	U64 GetSamplesForBits( U64 num_bits ) const
+	{
+		U64 fraction = mBitPeriod & 0xFFFFFFFF;
+		return num_bits * ( mBitPeriod >> 32 ) + ( num_bits >> 32 ) * fraction + ( ( ( num_bits & 0xFFFFFFFF ) * fraction ) >> 32 );
+	}
+
+	U64 mBitPeriod; // samples per bit, 32.32 fixed point
+	bool mMsbFirst;
+	U32 mLossOfSyncErrors;
+	U32 mLossOfSyncWindow;
+
+	//comma hunt state, bits are kept newest in bit 0:
+	struct HuntRun
+	{
+		U64 mFirstBit;       // index of the run's first bit in the hunted bitstream
+		U64 mFirstBitCenter; // sample at the center of that bit
+	};
+	enum { NumHuntRuns = 64 }; // one run per bit at worst
+	U64 mHuntBits;
+	U32 mHuntBitCount;
+	U64 mHuntBitTotal;
+	HuntRun mHuntRuns[ NumHuntRuns ];
+	U32 mHuntRunCount;
+
+	//8b10b symbol state:
+	U16 mSlidingWindow;
+	U32 mBitsInWindow;
+	U64 mSymbolFirstBitCenter;
+	U8 mRunningDisparity;
+	bool mSynchronized;
+	bool mFirstSymbol; // Track if this is the first symbol after synchronization
+
+	//loss of sync state:
+	std::vector<U64> mRecentErrors; // symbol indices of the last mLossOfSyncErrors errors
+	U64 mErrorCount;
+	U64 mSymbolIndex;
+	U64 mUnlockedSince;
+	U64 mHuntStartBit;
+	LockLossCause mLockLossCause;
+};
+
+template <class Sink>
+void decode8b10bSymbolDecoder::ShiftInBits( BitState bit_state, U64 num_bits, U64 first_bit_center, Sink& sink )
+{
+	U16 bit = ( bit_state == BIT_HIGH ) ? 1 : 0;
+
+	while( num_bits > 0 )
+	{
+		if( mSynchronized )
+		{
+			// Stops early if the symbol errors cost us lock
+			U64 used = ShiftInSymbolBits( bit, num_bits, first_bit_center, sink );
+			num_bits -= used;
+			first_bit_center += GetSamplesForBits( used );
+			continue;
+		}
+
+		// Until a comma is found, bits are collected into a 64-bit word and searched at all alignments at once
+		U32 take = U32( std::min<U64>( num_bits, 64 - mHuntBitCount ) );
+		HuntRun& run = mHuntRuns[ mHuntRunCount++ % NumHuntRuns ];
+		run.mFirstBit = mHuntBitTotal;
+		run.mFirstBitCenter = first_bit_center;
+
+		U64 run_bits = bit ? ( ~0ULL >> ( 64 - take ) ) : 0;
+		mHuntBits = ( take == 64 ? 0 : ( mHuntBits << take ) ) | run_bits;
+		mHuntBitCount += take;
+		mHuntBitTotal += take;
+		num_bits -= take;
+		first_bit_center += GetSamplesForBits( take );
+
+		HuntForComma( sink );
+
+		// Keep enough overlap that a comma straddling two words is still found
+		if( !mSynchronized && mHuntBitCount == 64 )
+			mHuntBitCount = 9;
+	}
+}
+
+template <class Sink>
+void decode8b10bSymbolDecoder::Finish( U64 end_sample, Sink& sink )
+{
+	if( mSynchronized )
+		return;
+
+	SyncEvent sync = { mUnlockedSince, end_sample, mHuntBitTotal - mHuntStartBit, mLockLossCause, false };
+	sink.OnSyncEvent( sync );
+}
+
+template <class Sink>
+void decode8b10bSymbolDecoder::HuntForComma( Sink& sink )
+{
+	if( mHuntBitCount < 10 )
+		return;
+
+	// The whole symbol holding the comma must be inside the word. LSB first, the comma starts the symbol and is
+	// followed by 3 more bits; MSB first, it ends the symbol.
+	U32 comma_to_symbol_end = mMsbFirst ? 0 : 3;
+	U64 valid_ends = ( ~0ULL >> ( 64 - ( mHuntBitCount - 9 + comma_to_symbol_end ) ) ) & ( ~0ULL << comma_to_symbol_end );
+	U64 commas = mMsbFirst ? decode8b10bSymbolUtils::FindReversedCommas( mHuntBits ) : decode8b10bSymbolUtils::FindCommas( mHuntBits );
+	commas &= valid_ends;
+	if( commas == 0 )
+		return;
+
+	// Take the oldest comma so no symbols are skipped
+	U32 comma_end = decode8b10bSymbolUtils::HighestSetBit( commas );
+	U32 symbol_last = comma_end - comma_to_symbol_end;
+	U64 first_bit = mHuntBitTotal - 1 - ( symbol_last + 9 );
+
+	U64 first_bit_center = HuntBitCenter( first_bit );
+	SyncEvent sync = { mUnlockedSince, first_bit_center - ( mBitPeriod >> 33 ), first_bit - mHuntStartBit, mLockLossCause, true };
+	sink.OnSyncEvent( sync );
+
+	mSynchronized = true;
+	mFirstSymbol = true;
+	mErrorCount = 0;
+	mSlidingWindow = U16( mHuntBits >> symbol_last ) & 0x3FF;
+	if( mMsbFirst )
+		mSlidingWindow = decode8b10bSymbolUtils::ReverseBits10( mSlidingWindow );
+	ProcessSymbol( first_bit_center, HuntBitCenter( first_bit + 9 ), sink );
+
+	// Bits that arrived after the comma symbol belong to the following symbols
+	for( U32 i = symbol_last; i > 0; i-- )
+	{
+		if( !mSynchronized )
+		{
+			// Lock was lost again, the remaining bits go back to the hunt
+			mHuntBitCount = i;
+			mHuntStartBit = mHuntBitTotal - i;
+			return;
+		}
+
+		U64 bit_index = mHuntBitTotal - i;
+		ShiftInSymbolBits( U16( mHuntBits >> ( i - 1 ) ) & 1, 1, HuntBitCenter( bit_index ), sink );
+	}
+
+	mHuntBitCount = 0;
+	mHuntRunCount = 0;
+}
+
+template <class Sink>
+U64 decode8b10bSymbolDecoder::ShiftInSymbolBits( U16 bit, U64 num_bits, U64 first_bit_center, Sink& sink )
+{
+	U64 remaining = num_bits;
+
+	while( remaining > 0 && mSynchronized )
+	{
+		// Synchronized: shift as much of the run as fits in the current symbol at once
+		U64 bit_center = first_bit_center + GetSamplesForBits( num_bits - remaining );
+		if( mBitsInWindow == 0 )
+			mSymbolFirstBitCenter = bit_center;
+
+		U32 take = U32( std::min<U64>( remaining, 10 - mBitsInWindow ) );
+		U16 run_bits = bit ? ( ( 1 << take ) - 1 ) : 0;
+		if( mMsbFirst )
+			mSlidingWindow = ( mSlidingWindow >> take ) | ( run_bits << ( 10 - take ) ); // first bit ends up in bit 0
+		else
+			mSlidingWindow = ( ( mSlidingWindow << take ) | run_bits ) & 0x3FF;
+		mBitsInWindow += take;
+		remaining -= take;
+
+		if( mBitsInWindow == 10 )
+			ProcessSymbol( mSymbolFirstBitCenter, first_bit_center + GetSamplesForBits( num_bits - remaining - 1 ), sink );
+	}
+
+	return num_bits - remaining;
+}
+
+template <class Sink>
+void decode8b10bSymbolDecoder::ProcessSymbol( U64 first_bit_center, U64 last_bit_center, Sink& sink )
+{
+	// Single table load covers decode and disparity accounting
+	const decode8b10bSymbolUtils::SymbolInfo& symbol = decode8b10bSymbolUtils::LookupSymbol(mSlidingWindow);
+	U16 decoded_value = symbol.mDecoded;
+	bool is_valid = decode8b10bSymbolUtils::IsValid(symbol);
+	U8 ones_count = symbol.mOnesCount;
+
+	// Advance to next 10-bit symbol
+	mBitsInWindow = 0;
+
+	SymbolError symbol_error = is_valid ? NoSymbolError : InvalidCodeError;
+	if (ones_count > 5 && mRunningDisparity == 0)
+	{
+		mRunningDisparity = 1; // Set running disparity to positive
+	}
+	else if (ones_count < 5 && mRunningDisparity == 1)
+	{
+		mRunningDisparity = 0; // Set running disparity to negative
+	}
+	else if (!mFirstSymbol && ones_count > 5 && mRunningDisparity == 1)
+	{
+		symbol_error = TooManyOnesError;
+	}
+	else if (!mFirstSymbol && ones_count < 5 && mRunningDisparity == 0)
+	{
+		symbol_error = TooManyZerosError;
+	}
+
+	U64 frame_start = first_bit_center - ( mBitPeriod >> 33 );
+	U64 frame_end = last_bit_center + ( mBitPeriod >> 33 );
+	bool lost_sync = TrackSyncErrors( symbol_error != NoSymbolError );
+
+	Symbol record = { frame_start, frame_end, mSlidingWindow, decoded_value, U8( symbol_error ) };
+	sink.OnSymbolDecoded( record );
+
+	mFirstSymbol = false; // After first symbol, we are no longer in the initial state
+
+	if( lost_sync )
+	{
+		sink.OnSyncLost( frame_end );
+		mSynchronized = false;
+		mUnlockedSince = frame_end;
+		mLockLossCause = LossByErrors;
+		mHuntStartBit = mHuntBitTotal;
+	}
+}
+
+#endif // DECODE8B10B_SYMBOL_DECODER_H
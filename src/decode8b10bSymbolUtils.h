@@ -3,6 +3,9 @@
 
 #include <AnalyzerTypes.h>
 #include <tuple>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
 
 class decode8b10bSymbolUtils
 {
@@ -13,9 +16,119 @@ public:
 		Positive,
 		Same
 	};
-	
+
+	// Bits of SymbolInfo::mFlags; the disparity class is stored in bits 2-3
+	enum SymbolFlags
+	{
+		SymbolValid = 0x01,
+		SymbolControl = 0x02,
+		DisparityShift = 2
+	};
+
+	enum SymbolNameIndex
+	{
+		NumDataSymbols = 256,
+		NumControlSymbols = 12,
+		UnknownSymbolName = NumDataSymbols + NumControlSymbols,
+		NumSymbolNames
+	};
+
+	// Everything known about one 10-bit pattern, so decode, naming and disparity accounting are a single load
+	struct SymbolInfo
+	{
+		U16 mDecoded;   // 8-bit value, bit 8 set for K-characters (K28.5 = 0x1BC)
+		U16 mNameIndex; // index into the symbol name table
+		U8 mOnesCount;  // number of ones in the 10-bit pattern, valid or not
+		U8 mFlags;      // SymbolFlags
+	};
+
+	static const SymbolInfo& LookupSymbol(U16 ten_bit_code)
+	{
+		return sSymbolTable[ten_bit_code & 0x3FF];
+	}
+
+	static bool IsValid(const SymbolInfo& symbol)
+	{
+		return (symbol.mFlags & SymbolValid) != 0;
+	}
+
+	static bool IsControl(const SymbolInfo& symbol)
+	{
+		return (symbol.mFlags & SymbolControl) != 0;
+	}
+
+	static Disparity GetDisparity(const SymbolInfo& symbol)
+	{
+		return Disparity((symbol.mFlags >> DisparityShift) & 0x3);
+	}
+
+	static const char* GetSymbolName(const SymbolInfo& symbol)
+	{
+		return sSymbolNames[symbol.mNameIndex];
+	}
+
+	// Comma search over a 64-bit bitstream word holding the newest bit in bit 0. Returns a mask with bit p set
+	// when a comma (0011111 or 1100000, found in K28.1, K28.5 and K28.7) ends at bit p, testing every
+	// alignment at once. Matches within 6 bits of the top of the word must be ignored by the caller.
+	static U64 FindCommas(U64 bits)
+	{
+		U64 ones = bits & (bits >> 1) & (bits >> 2) & (bits >> 3) & (bits >> 4);
+		U64 zeros = ~(bits | (bits >> 1) | (bits >> 2) | (bits >> 3) | (bits >> 4));
+		U64 comma_minus = ~(bits >> 6) & ~(bits >> 5) & ones; // 00 11111
+		U64 comma_plus = (bits >> 6) & (bits >> 5) & zeros;   // 11 00000
+		return comma_minus | comma_plus;
+	}
+
+	// FindCommas for links that send each symbol's last bit first: the comma patterns arrive as 1111100 and
+	// 0000011 and end the symbol instead of starting it. Same bit layout and limits as FindCommas.
+	static U64 FindReversedCommas(U64 bits)
+	{
+		U64 ones = (bits >> 2) & (bits >> 3) & (bits >> 4) & (bits >> 5) & (bits >> 6);
+		U64 zeros = ~((bits >> 2) | (bits >> 3) | (bits >> 4) | (bits >> 5) | (bits >> 6));
+		U64 comma_minus = ~(bits >> 1) & ~bits & ones; // 11111 00
+		U64 comma_plus = (bits >> 1) & bits & zeros;   // 00000 11
+		return comma_minus | comma_plus;
+	}
+
+	// Mirrors a 10-bit code (bit 9 <-> bit 0) with two 5-bit table loads
+	static U16 ReverseBits10(U16 code)
+	{
+		return U16((sReverseBits5[code & 0x1F] << 5) | sReverseBits5[(code >> 5) & 0x1F]);
+	}
+
+	// Index of the highest set bit, value must be non-zero
+	static U32 HighestSetBit(U64 value)
+	{
+#if defined(_MSC_VER)
+		unsigned long index;
+		_BitScanReverse64(&index, value);
+		return index;
+#else
+		return 63 - __builtin_clzll(value);
+#endif
+	}
+
+	// Encodes a 9-bit value (bit 8 set for K-characters) at the current running disparity (0 = RD-, 1 = RD+) and
+	// updates it. Returns 0, leaving the disparity alone, for values with no 8b/10b character.
+	static U16 EncodeSymbol(U16 decoded, U8& running_disparity)
+	{
+		U16 code = sEncodeTable[decoded & 0x1FF][running_disparity & 1];
+		if (code != 0 && sSymbolTable[code].mOnesCount != 5)
+			running_disparity ^= 1;
+		return code;
+	}
+
 	static const char* GetSymbolName(U16 decoded_octet);
 	static std::tuple<U16, Disparity, bool> DecodeSymbol(U16 ten_bit_code);
+
+private:
+	static const SymbolInfo sSymbolTable[1024];
+	static const U16 sEncodeTable[512][2];
+	static const char* const sSymbolNames[NumSymbolNames];
+	static constexpr U8 sReverseBits5[32] = {
+		0x00, 0x10, 0x08, 0x18, 0x04, 0x14, 0x0C, 0x1C, 0x02, 0x12, 0x0A, 0x1A, 0x06, 0x16, 0x0E, 0x1E,
+		0x01, 0x11, 0x09, 0x19, 0x05, 0x15, 0x0D, 0x1D, 0x03, 0x13, 0x0B, 0x1B, 0x07, 0x17, 0x0F, 0x1F
+	};
 };
 
-#endif // DECODE8B10B_SYMBOL_UTILS_H
\ No newline at end of file
+#endif // DECODE8B10B_SYMBOL_UTILS_H
@@ -0,0 +1,258 @@
+#include "decode8b10bCapture.h"
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+decode8b10bCapture::decode8b10bCapture()
+:	mInitialHigh( false ),
+	mSampleRate( 0 ),
+	mDataBytes( 0 )
+{
+}
+
+static bool ReadStream( FILE* file, std::vector<U8>& data )
+{
+	U8 buffer[ 65536 ];
+	size_t count;
+	while( ( count = fread( buffer, 1, sizeof( buffer ), file ) ) > 0 )
+		data.insert( data.end(), buffer, buffer + count );
+	return ferror( file ) == 0;
+}
+
+static bool ReadFile( const char* path, std::vector<U8>& data )
+{
+	FILE* file = fopen( path, "rb" );
+	if( file == nullptr )
+		return false;
+
+	bool ok = ReadStream( file, data );
+	fclose( file );
+	return ok;
+}
+
+template <typename T>
+static bool ReadValue( const std::vector<U8>& data, U64& offset, T& value )
+{
+	if( offset + sizeof( T ) > data.size() )
+		return false;
+	memcpy( &value, &data[ offset ], sizeof( T ) );
+	offset += sizeof( T );
+	return true;
+}
+
+// Single-quoted for the shell
+static std::string QuoteArgument( const char* argument )
+{
+	std::string quoted = "'";
+	for( const char* c = argument; *c != 0; c++ )
+	{
+		if( *c == '\'' )
+			quoted += "'\\''";
+		else
+			quoted += *c;
+	}
+	return quoted + "'";
+}
+
+static bool RunCommand( const std::string& command, std::vector<U8>& output )
+{
+	FILE* pipe = popen( command.c_str(), "r" );
+	if( pipe == nullptr )
+		return false;
+
+	bool ok = ReadStream( pipe, output );
+	return pclose( pipe ) == 0 && ok;
+}
+
+bool decode8b10bCapture::Load( const char* path, S32 channel, U64 sample_rate, bool initial_high )
+{
+	mEdges.clear();
+
+	std::vector<U8> data;
+	if( !ReadFile( path, data ) )
+	{
+		fprintf( stderr, "cannot read %s\n", path );
+		return false;
+	}
+
+	// A .sal is a zip of the session's channel files
+	if( data.size() >= 4 && memcmp( &data[ 0 ], "PK\x03\x04", 4 ) == 0 )
+		return LoadSession( path, channel );
+
+	if( data.size() >= 16 && memcmp( &data[ 0 ], "<SALEAE>", 8 ) == 0 )
+	{
+		mDataBytes = data.size();
+		return LoadSaleaeFile( data, path, sample_rate );
+	}
+
+	return LoadEdgeText( path, sample_rate, initial_high );
+}
+
+bool decode8b10bCapture::LoadSession( const char* path, S32 channel )
+{
+	std::vector<U8> listing;
+	if( !RunCommand( "unzip -Z1 " + QuoteArgument( path ), listing ) )
+	{
+		fprintf( stderr, "%s: cannot list the session, is unzip installed?\n", path );
+		return false;
+	}
+
+	// Takes the requested channel, or the first digital one
+	std::string wanted = channel >= 0 ? "digital-" + std::to_string( channel ) + ".bin" : "";
+	std::string member;
+	std::string names( listing.begin(), listing.end() );
+	size_t start = 0;
+	while( start < names.size() && member.empty() )
+	{
+		size_t end = names.find( '\n', start );
+		if( end == std::string::npos )
+			end = names.size();
+		std::string name = names.substr( start, end - start );
+		start = end + 1;
+
+		bool is_digital = name.compare( 0, 8, "digital-" ) == 0 && name.size() > 12 && name.compare( name.size() - 4, 4, ".bin" ) == 0;
+		if( wanted.empty() ? is_digital : name == wanted )
+			member = name;
+	}
+
+	if( member.empty() )
+	{
+		fprintf( stderr, "%s: no %s in the session\n", path, wanted.empty() ? "digital channel" : wanted.c_str() );
+		return false;
+	}
+
+	std::vector<U8> data;
+	if( !RunCommand( "unzip -p " + QuoteArgument( path ) + " " + QuoteArgument( member.c_str() ), data ) )
+	{
+		fprintf( stderr, "%s: cannot extract %s\n", path, member.c_str() );
+		return false;
+	}
+
+	mDataBytes = data.size();
+	if( data.size() < 16 || memcmp( &data[ 0 ], "<SALEAE>", 8 ) != 0 )
+	{
+		fprintf( stderr, "%s: %s is not a Saleae channel file\n", path, member.c_str() );
+		return false;
+	}
+	return LoadSaleaeFile( data, path, 0 );
+}
+
+bool decode8b10bCapture::LoadSaleaeFile( const std::vector<U8>& data, const char* path, U64 sample_rate )
+{
+	S32 version, type;
+	memcpy( &version, &data[ 8 ], 4 );
+	memcpy( &type, &data[ 12 ], 4 );
+	if( type == 0 && version <= 1 )
+		return LoadBinaryExport( data, sample_rate );
+	if( type == 100 && version == 2 )
+		return LoadSessionChannel( data );
+
+	fprintf( stderr, "%s: unsupported Saleae file version %d type %d\n", path, version, type );
+	return false;
+}
+
+// Logic 2 binary export of a digital channel: header, then one double per transition in seconds
+bool decode8b10bCapture::LoadBinaryExport( const std::vector<U8>& data, U64 sample_rate )
+{
+	U64 offset = 16;
+	U32 initial_state;
+	double begin_time, end_time;
+	U64 num_transitions;
+	if( !ReadValue( data, offset, initial_state ) || !ReadValue( data, offset, begin_time ) || !ReadValue( data, offset, end_time ) ||
+		!ReadValue( data, offset, num_transitions ) )
+		return false;
+
+	if( sample_rate == 0 )
+	{
+		fprintf( stderr, "binary exports store times, --sample-rate is needed to convert them to samples\n" );
+		return false;
+	}
+
+	mInitialHigh = ( initial_state != 0 );
+	mSampleRate = sample_rate;
+	mEdges.reserve( num_transitions );
+	for( U64 i = 0; i < num_transitions; i++ )
+	{
+		double time;
+		if( !ReadValue( data, offset, time ) )
+			return false;
+		mEdges.push_back( U64( ( time - begin_time ) * double( sample_rate ) + 0.5 ) );
+	}
+	return true;
+}
+
+// Channel data as stored inside a .sal: blocks of transitions, each the number of samples since the previous
+// edge less one, as little-endian base-128 varints
+bool decode8b10bCapture::LoadSessionChannel( const std::vector<U8>& data )
+{
+	U64 offset = 16;
+	U8 initial_state;
+	double sample_rate;
+	U64 num_blocks;
+	if( !ReadValue( data, offset, initial_state ) || !ReadValue( data, offset, sample_rate ) )
+		return false;
+	offset = 0x2B; // capture start time, not needed here
+	if( !ReadValue( data, offset, num_blocks ) )
+		return false;
+
+	mInitialHigh = ( initial_state != 0 );
+	mSampleRate = U64( sample_rate );
+
+	for( U64 block = 0; block < num_blocks; block++ )
+	{
+		U64 block_start, num_transitions;
+		U64 header = offset;
+		if( !ReadValue( data, offset, block_start ) )
+			return false;
+		offset = header + 18;
+		if( !ReadValue( data, offset, num_transitions ) )
+			return false;
+
+		U64 sample = block_start;
+		for( U64 i = 0; i < num_transitions; i++ )
+		{
+			U64 delta = 0;
+			for( U32 shift = 0;; shift += 7 )
+			{
+				if( offset >= data.size() || shift > 63 )
+					return false;
+				U8 byte = data[ offset++ ];
+				delta |= U64( byte & 0x7F ) << shift;
+				if( ( byte & 0x80 ) == 0 )
+					break;
+			}
+			sample += delta + 1;
+			mEdges.push_back( sample );
+		}
+	}
+	return true;
+}
+
+bool decode8b10bCapture::LoadEdgeText( const char* path, U64 sample_rate, bool initial_high )
+{
+	FILE* file = fopen( path, "r" );
+	if( file == nullptr )
+		return false;
+
+	if( sample_rate == 0 )
+	{
+		fprintf( stderr, "edge text files need --sample-rate\n" );
+		fclose( file );
+		return false;
+	}
+
+	mInitialHigh = initial_high;
+	mSampleRate = sample_rate;
+
+	char line[ 256 ];
+	while( fgets( line, sizeof( line ), file ) != nullptr )
+	{
+		mDataBytes += strlen( line );
+		if( line[ 0 ] == '#' || line[ 0 ] == '\n' || line[ 0 ] == '\r' )
+			continue;
+		mEdges.push_back( strtoull( line, nullptr, 10 ) );
+	}
+	fclose( file );
+	return true;
+}
@@ -0,0 +1,33 @@
+#ifndef DECODE8B10B_CAPTURE_H
+#define DECODE8B10B_CAPTURE_H
+
+#include <AnalyzerTypes.h>
+#include <vector>
+
+// Edges of one digital channel loaded from disk, as sample numbers from the start of the capture. Reads:
+//   - a Logic 2 .sal session, through `unzip`, taking the requested digital channel or the first one
+//   - digital-N.bin as stored inside a .sal
+//   - a Logic 2 binary export of one digital channel (needs the sample rate)
+//   - a text file with one edge sample number per line (needs the sample rate and initial state)
+// Problems are reported on stderr.
+class decode8b10bCapture
+{
+public:
+	decode8b10bCapture();
+
+	bool Load( const char* path, S32 channel, U64 sample_rate, bool initial_high );
+
+	std::vector<U64> mEdges;
+	bool mInitialHigh;
+	U64 mSampleRate;
+	U64 mDataBytes; // size of the channel data as stored, for throughput figures
+
+protected:
+	bool LoadSession( const char* path, S32 channel );
+	bool LoadSaleaeFile( const std::vector<U8>& data, const char* path, U64 sample_rate );
+	bool LoadBinaryExport( const std::vector<U8>& data, U64 sample_rate );
+	bool LoadSessionChannel( const std::vector<U8>& data );
+	bool LoadEdgeText( const char* path, U64 sample_rate, bool initial_high );
+};
+
+#endif // DECODE8B10B_CAPTURE_H
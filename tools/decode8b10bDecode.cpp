@@ -0,0 +1,342 @@
+// Offline 8b/10b decoder: runs the plugin's decoder core over a capture file without Logic 2.
+// Build with -DDECODE8B10B_BUILD_TOOLS=ON and run decode8b10bDecode --help.
+
+#include "decode8b10bDecoderCore.h"
+#include "decode8b10bEdgeSource.h"
+#include "decode8b10bCapture.h"
+#include "decode8b10bBitRateDetector.h"
+#include "decode8b10bOrderedSetDecoder.h"
+#include "decode8b10bSegmentDecoder.h"
+#include "decode8b10bSymbolUtils.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+struct Options
+{
+	const char* mInput = nullptr;
+	const char* mOutput = nullptr;
+	U64 mBitRate = 0;
+	bool mDetectBitRate = false;
+	U64 mSampleRate = 0;
+	S32 mChannel = -1;
+	bool mInitialHigh = false;
+	bool mMsbFirst = false;
+	bool mOrderedSets = false;
+	bool mBitByBit = false;
+	bool mClockRecovery = false;
+	U32 mPllGainShift = 5;
+	bool mStatsOnly = false;
+	U32 mLossOfSyncErrors = 4;
+	U32 mLossOfSyncWindow = 16;
+	U32 mThreads = 1;
+};
+
+static void PrintUsage()
+{
+	printf( "usage: decode8b10bDecode --bit-rate <bits/s> | --detect-bit-rate [options] <capture>\n"
+			"\n"
+			"  <capture>                  a Logic 2 .sal (needs unzip), digital-N.bin from inside one, a Logic 2 binary\n"
+			"                             export of one digital channel, or a text file with one edge sample number per line\n"
+			"  --channel N                .sal sessions: decode digital channel N instead of the first one\n"
+			"  --bit-rate N               line rate in bits per second\n"
+			"  --detect-bit-rate          measure the line rate from the first edges, falling back to --bit-rate if given\n"
+			"  --sample-rate N            sample rate in Hz, needed for binary exports and edge text files\n"
+			"  --initial-high             edge text files: the line is high before the first edge\n"
+			"  --msb-first                bit j of each symbol is sent first\n"
+			"  --ordered-sets             group 1000BASE-X / SGMII ordered sets and packets\n"
+			"  --bit-by-bit               sample every bit center instead of measuring runs between edges\n"
+			"  --clock-recovery           measure runs against a bit clock recovered by a PLL, for fractional or drifting rates\n"
+			"  --pll-gain-shift N         clock recovery loop gains 2^-N and 2^-(2N+1), larger is narrower (default 5)\n"
+			"  --loss-of-sync-errors N    errors within the window that drop lock, 0 never drops it, up to 64 (default 4)\n"
+			"  --loss-of-sync-window N    symbols the errors must fall within (default 16)\n"
+			"  --threads N                decode in segments on N threads and stitch them where they agree (default 1)\n"
+			"  --output FILE              write the decoded frames as CSV to FILE instead of stdout\n"
+			"  --stats                    only print the summary\n" );
+}
+
+static bool ParseOptions( int argc, char** argv, Options& options )
+{
+	for( int i = 1; i < argc; i++ )
+	{
+		const char* arg = argv[ i ];
+		bool has_value = ( i + 1 < argc );
+
+		if( !strcmp( arg, "--bit-rate" ) && has_value )
+			options.mBitRate = strtoull( argv[ ++i ], nullptr, 10 );
+		else if( !strcmp( arg, "--detect-bit-rate" ) )
+			options.mDetectBitRate = true;
+		else if( !strcmp( arg, "--sample-rate" ) && has_value )
+			options.mSampleRate = strtoull( argv[ ++i ], nullptr, 10 );
+		else if( !strcmp( arg, "--channel" ) && has_value )
+			options.mChannel = S32( strtol( argv[ ++i ], nullptr, 10 ) );
+		else if( !strcmp( arg, "--initial-high" ) )
+			options.mInitialHigh = true;
+		else if( !strcmp( arg, "--msb-first" ) )
+			options.mMsbFirst = true;
+		else if( !strcmp( arg, "--ordered-sets" ) )
+			options.mOrderedSets = true;
+		else if( !strcmp( arg, "--bit-by-bit" ) )
+			options.mBitByBit = true;
+		else if( !strcmp( arg, "--clock-recovery" ) )
+			options.mClockRecovery = true;
+		else if( !strcmp( arg, "--pll-gain-shift" ) && has_value )
+			options.mPllGainShift = U32( strtoul( argv[ ++i ], nullptr, 10 ) );
+		else if( !strcmp( arg, "--loss-of-sync-errors" ) && has_value )
+			options.mLossOfSyncErrors = U32( strtoul( argv[ ++i ], nullptr, 10 ) );
+		else if( !strcmp( arg, "--loss-of-sync-window" ) && has_value )
+			options.mLossOfSyncWindow = U32( strtoul( argv[ ++i ], nullptr, 10 ) );
+		else if( !strcmp( arg, "--threads" ) && has_value )
+			options.mThreads = U32( strtoul( argv[ ++i ], nullptr, 10 ) );
+		else if( !strcmp( arg, "--output" ) && has_value )
+			options.mOutput = argv[ ++i ];
+		else if( !strcmp( arg, "--stats" ) )
+			options.mStatsOnly = true;
+		else if( arg[ 0 ] != '-' && options.mInput == nullptr )
+			options.mInput = arg;
+		else
+			return false;
+	}
+
+	return options.mInput != nullptr && ( options.mBitRate != 0 || options.mDetectBitRate ) && options.mLossOfSyncErrors <= 64 && options.mLossOfSyncWindow != 0 && options.mThreads != 0 && options.mPllGainShift >= 1 && options.mPllGainShift <= 15;
+}
+
+// Writes frames in the same column layout as the plugin's CSV export and keeps the summary counts. Used as the
+// decoder core's sink directly, so the symbol callbacks are not virtual.
+class FrameWriter : public decode8b10bOrderedSetDecoder::Listener
+{
+public:
+	FrameWriter( FILE* output, const Options& options, U64 sample_rate )
+	:	mOutput( output ),
+		mOrderedSets( options.mOrderedSets ),
+		mSampleRate( sample_rate )
+	{
+		if( mOutput != nullptr )
+			fprintf( mOutput, "Time [s],Symbol,Type,Value,10-bit Code,5b/6b,3b/4b,Error\n" );
+	}
+
+	void Finish()
+	{
+		mOrderedSetDecoder.Flush( *this );
+	}
+
+	void OnSymbolDecoded( const decode8b10bSymbolDecoder::Symbol& symbol )
+	{
+		if( mOrderedSets )
+			mOrderedSetDecoder.AddSymbol( symbol, *this );
+		else
+			OnSymbol( symbol );
+	}
+
+	void OnSyncEvent( const decode8b10bSymbolDecoder::SyncEvent& sync )
+	{
+		if( sync.mAcquired )
+			mLocks++;
+
+		if( mOutput != nullptr )
+			fprintf( mOutput, "%.9f,Sync: %llu bits hunted,Sync,%llu,,,,\n", Time( sync.mUnlockedSince ), ( unsigned long long )sync.mHuntedBits,
+					 ( unsigned long long )sync.mHuntedBits );
+	}
+
+	void OnSyncLost( U64 /*sample*/ )
+	{
+		mLockLosses++;
+		mOrderedSetDecoder.Flush( *this );
+	}
+
+	virtual void OnSymbol( const decode8b10bOrderedSetDecoder::Symbol& symbol )
+	{
+		const decode8b10bSymbolUtils::SymbolInfo& info = decode8b10bSymbolUtils::LookupSymbol( symbol.mCode );
+		bool is_valid = decode8b10bSymbolUtils::IsValid( info );
+		bool is_control = decode8b10bSymbolUtils::IsControl( info );
+
+		mSymbols++;
+		mErrors[ symbol.mError ]++;
+		if( is_valid )
+			( is_control ? mControlSymbols : mDataSymbols )++;
+
+		if( mOutput == nullptr )
+			return;
+
+		static const char* const rd_names[] = { " RD-", " RD+", " RD+/-" };
+		char code_str[ 11 ];
+		for( int bit = 0; bit < 10; bit++ )
+			code_str[ bit ] = ( symbol.mCode & ( 0x200 >> bit ) ) ? '1' : '0';
+		code_str[ 10 ] = 0;
+
+		fprintf( mOutput, "%.9f,%s%s,%s,%u,%s,%.6s,%s,%s\n", Time( symbol.mStart ), decode8b10bSymbolUtils::GetSymbolName( info ),
+				 is_valid ? rd_names[ int( decode8b10bSymbolUtils::GetDisparity( info ) ) ] : "", !is_valid ? "Error" : is_control ? "Control" : "Data",
+				 unsigned( symbol.mDecoded ), code_str, code_str, code_str + 6,
+				 decode8b10bSymbolDecoder::GetSymbolErrorText( decode8b10bSymbolDecoder::SymbolError( symbol.mError ) ) );
+	}
+
+	virtual void OnOrderedSet( const decode8b10bOrderedSetDecoder::OrderedSet& ordered_set )
+	{
+		mSymbols += ( ordered_set.mType == decode8b10bOrderedSetDecoder::ConfigSet1 || ordered_set.mType == decode8b10bOrderedSetDecoder::ConfigSet2 ) ? 4 :
+					( ordered_set.mType == decode8b10bOrderedSetDecoder::IdleSet1 || ordered_set.mType == decode8b10bOrderedSetDecoder::IdleSet2 ) ? 2 : 1;
+		mOrderedSetCount++;
+
+		if( mOutput != nullptr )
+			fprintf( mOutput, "%.9f,%s,Ordered Set,%u,,,,\n", Time( ordered_set.mStart ), decode8b10bOrderedSetDecoder::GetOrderedSetName( ordered_set.mType ),
+					 unsigned( ordered_set.mType ) );
+	}
+
+	virtual void OnPacket( const decode8b10bOrderedSetDecoder::Packet& packet )
+	{
+		mSymbols += packet.mBytes.size() + ( packet.mTerminated ? 2 : 1 );
+		mPackets++;
+		if( !packet.mCrcValid )
+			mCrcErrors++;
+
+		U64 frame_length = packet.mFrameOffset != 0 ? packet.mBytes.size() - packet.mFrameOffset : 0;
+		if( mOutput != nullptr )
+			fprintf( mOutput, "%.9f,Packet %llu bytes, %s, %u errors%s,Packet,%llu,,,,\n", Time( packet.mStart ), ( unsigned long long )frame_length,
+					 packet.mCrcValid ? "CRC OK" : "CRC bad", packet.mErrorCount, packet.mTerminated ? "" : ", no /T/", ( unsigned long long )frame_length );
+	}
+
+	void PrintStats( FILE* file, double seconds, U64 capture_bytes ) const
+	{
+		fprintf( file, "symbols:         %llu (%llu data, %llu control)\n", ( unsigned long long )mSymbols, ( unsigned long long )mDataSymbols,
+				 ( unsigned long long )mControlSymbols );
+		fprintf( file, "invalid codes:   %llu\n", ( unsigned long long )mErrors[ decode8b10bSymbolDecoder::InvalidCodeError ] );
+		fprintf( file, "disparity errors: %llu\n", ( unsigned long long )( mErrors[ decode8b10bSymbolDecoder::TooManyOnesError ] +
+																		  mErrors[ decode8b10bSymbolDecoder::TooManyZerosError ] ) );
+		fprintf( file, "lock acquired:   %llu times, lost %llu times\n", ( unsigned long long )mLocks, ( unsigned long long )mLockLosses );
+		if( mOrderedSets )
+			fprintf( file, "ordered sets:    %llu, packets: %llu (%llu CRC errors)\n", ( unsigned long long )mOrderedSetCount, ( unsigned long long )mPackets,
+					 ( unsigned long long )mCrcErrors );
+		fprintf( file, "decode time:     %.3f s (%.1f Msymbols/s)\n", seconds, seconds > 0 ? double( mSymbols ) / seconds / 1e6 : 0.0 );
+		double capture_mb = double( capture_bytes ) / ( 1 << 20 );
+		fprintf( file, "capture data:    %.2f MB (%.3f s/MB)\n", capture_mb, capture_mb > 0 ? seconds / capture_mb : 0.0 );
+	}
+
+protected:
+	double Time( U64 sample ) const
+	{
+		return double( sample ) / double( mSampleRate );
+	}
+
+	FILE* mOutput;
+	bool mOrderedSets;
+	U64 mSampleRate;
+	decode8b10bOrderedSetDecoder mOrderedSetDecoder;
+
+	U64 mSymbols = 0;
+	U64 mDataSymbols = 0;
+	U64 mControlSymbols = 0;
+	U64 mErrors[ 4 ] = {};
+	U64 mLocks = 0;
+	U64 mLockLosses = 0;
+	U64 mOrderedSetCount = 0;
+	U64 mPackets = 0;
+	U64 mCrcErrors = 0;
+};
+
+int main( int argc, char** argv )
+{
+	Options options;
+	if( !ParseOptions( argc, argv, options ) )
+	{
+		PrintUsage();
+		return 2;
+	}
+
+	decode8b10bCapture capture;
+	if( !capture.Load( options.mInput, options.mChannel, options.mSampleRate, options.mInitialHigh ) )
+		return 1;
+
+	// Same prefix as the plugin measures, so both report the same rate
+	if( options.mDetectBitRate )
+	{
+		U64 num_edges = std::min<U64>( capture.mEdges.size(), decode8b10bBitRateDetector::DetectionEdges );
+		std::vector<U64> edges( capture.mEdges.begin(), capture.mEdges.begin() + num_edges );
+		decode8b10bBitRateDetector::Estimate estimate = decode8b10bBitRateDetector::Detect( edges, capture.mSampleRate );
+		if( estimate.mDetected )
+		{
+			fprintf( stderr, "detected %u bits/s from %u runs (%.3f samples per bit)\n", estimate.mBitRate, estimate.mFittedRuns, estimate.mSamplesPerBit );
+			options.mBitRate = estimate.mBitRate;
+		}
+		else if( options.mBitRate != 0 )
+		{
+			fprintf( stderr, "bit rate not detected (%u of %u runs fit), using %llu bits/s\n", estimate.mFittedRuns, estimate.mRuns,
+					 ( unsigned long long )options.mBitRate );
+		}
+		else
+		{
+			fprintf( stderr, "bit rate not detected (%u of %u runs fit), give it with --bit-rate\n", estimate.mFittedRuns, estimate.mRuns );
+			return 1;
+		}
+	}
+
+	// The bit period is 32.32 fixed point: at least one sample per bit, and a bit rate below 2^32
+	U64 samples_per_bit = capture.mSampleRate / options.mBitRate;
+	if( samples_per_bit == 0 || samples_per_bit > 0xFFFFFFFF || options.mBitRate > 0xFFFFFFFF )
+	{
+		fprintf( stderr, "a %llu Hz capture cannot carry %llu bits/s\n", ( unsigned long long )capture.mSampleRate,
+				 ( unsigned long long )options.mBitRate );
+		return 1;
+	}
+
+	FILE* output = nullptr;
+	if( !options.mStatsOnly )
+	{
+		output = options.mOutput != nullptr ? fopen( options.mOutput, "w" ) : stdout;
+		if( output == nullptr )
+		{
+			fprintf( stderr, "cannot write %s\n", options.mOutput );
+			return 1;
+		}
+	}
+
+	FrameWriter writer( output, options, capture.mSampleRate );
+	auto start = std::chrono::steady_clock::now();
+
+	// The same bit recovery as the plugin, starting from the second edge
+	if( options.mThreads > 1 )
+	{
+		decode8b10bSegmentDecoder::Settings settings = { decode8b10bSymbolDecoder::GetBitPeriod( capture.mSampleRate, options.mBitRate ), options.mMsbFirst,
+														 options.mLossOfSyncErrors, options.mLossOfSyncWindow,
+														 options.mClockRecovery ? decode8b10bSegmentDecoder::ClockRecoverySampling :
+														 options.mBitByBit ? decode8b10bSegmentDecoder::PerBitSampling :
+																			 decode8b10bSegmentDecoder::EdgeRunSampling,
+														 options.mPllGainShift };
+
+		decode8b10bSegmentDecoder decoder( capture.mEdges, capture.mInitialHigh ? BIT_HIGH : BIT_LOW );
+		decoder.Decode( settings, options.mThreads, writer );
+		writer.Finish();
+		decoder.Finish( writer );
+
+		// Around such a boundary the output may differ from a single-threaded decode
+		if( decoder.GetBoundaryCuts() != 0 )
+			fprintf( stderr, "%llu of %llu segment boundaries fell where the decodes never agreed and were cut\n",
+					 ( unsigned long long )decoder.GetBoundaryCuts(), ( unsigned long long )( decoder.GetSegmentCount() - 1 ) );
+	}
+	else if( capture.mEdges.size() >= 2 )
+	{
+		decode8b10bEdgeSource source( capture.mEdges, capture.mInitialHigh ? BIT_HIGH : BIT_LOW );
+		decode8b10bDecoderCore<decode8b10bEdgeSource, FrameWriter> core( source, writer );
+		core.Start( decode8b10bSymbolDecoder::GetBitPeriod( capture.mSampleRate, options.mBitRate ), options.mMsbFirst, options.mLossOfSyncErrors, options.mLossOfSyncWindow );
+
+		if( options.mClockRecovery )
+			core.DecodeClockRecovery( options.mPllGainShift );
+		else if( options.mBitByBit )
+			core.DecodeBitByBit();
+		else
+			core.DecodeEdgeRuns();
+
+		writer.Finish();
+		core.Finish();
+	}
+
+	double seconds = std::chrono::duration<double>( std::chrono::steady_clock::now() - start ).count();
+
+	if( output != nullptr && output != stdout )
+		fclose( output );
+
+	writer.PrintStats( options.mStatsOnly || output != stdout ? stdout : stderr, seconds, capture.mDataBytes );
+	return 0;
+}
@@ -0,0 +1,916 @@
+// Golden-capture regression and throughput check for the decoder core, runnable on any machine without Logic 2.
+// Decodes the captures checked in with the repo plus a set of generated ones in several decode modes, compares
+// a digest of every decoded stream with tools/golden/decode8b10bRegress.txt and reports decode time per MB of
+// capture data. Generated captures without injected errors are also compared symbol for symbol with what was
+// sent. Build with -DDECODE8B10B_BUILD_TOOLS=ON and run decode8b10bRegress --help.
+
+#include "decode8b10bBitRateDetector.h"
+#include "decode8b10bCapture.h"
+#include "decode8b10bDecodePipeline.h"
+#include "decode8b10bDecoderCore.h"
+#include "decode8b10bEdgeSource.h"
+#include "decode8b10bLaneDeskew.h"
+#include "decode8b10bOrderedSetDecoder.h"
+#include "decode8b10bSegmentDecoder.h"
+#include "decode8b10bSymbolUtils.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cmath>
+#include <condition_variable>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#ifndef DECODE8B10B_SOURCE_DIR
+#define DECODE8B10B_SOURCE_DIR "."
+#endif
+
+// Decoded values of the characters in the generated traffic
+enum
+{
+	K28_5 = 0x1BC, // comma, first character of every idle ordered set
+	K23_7 = 0x1F7, // /R/ carrier extend
+	K27_7 = 0x1FB, // /S/ start of packet
+	K29_7 = 0x1FD, // /T/ end of packet
+	D5_6 = 0xC5,
+	D16_2 = 0x50,
+	IdleSecondSymbol = 0x200 // resolved to D5.6 (/I1/) or D16.2 (/I2/) by the running disparity when encoded
+};
+
+struct GeneratorSettings
+{
+	U32 mSymbols;
+	double mSamplesPerBit; // nominal, what the decoder is told
+	U32 mIdlePercent;   // chance of idle rather than a packet after each gap
+	U32 mErrorInterval; // symbols between injected errors, 0 for none
+	bool mBitSlips;     // injected errors drop a bit instead of corrupting a code
+	bool mMsbFirst;
+	U32 mJitter;        // edges move by up to this many samples either way
+	S32 mOffsetPpm;     // actual bit rate below (+) or above (-) nominal, as a crystal offset
+	U32 mSscPpm;        // spread-spectrum down-spread, triangular at 33 kHz
+	U64 mStartOffset;   // samples of quiet line before the traffic, past 2^32 to exercise 64-bit timing
+};
+
+// One capture the cases decode, either loaded or generated
+struct CaptureSource
+{
+	CaptureSource( const char* name, U64 bit_rate, bool generated, const GeneratorSettings& generator )
+	:	mName( name ),
+		mBitRate( bit_rate ),
+		mGenerated( generated ),
+		mGenerator( generator ),
+		mAvailable( false )
+	{
+	}
+
+	const char* mName;
+	U64 mBitRate;
+	bool mGenerated;
+	GeneratorSettings mGenerator;
+	decode8b10bCapture mCapture;
+	std::vector<U16> mSentCodes; // generated only, in standard bit order
+	std::vector<U64> mSentStarts; // sample each sent symbol starts at
+	bool mAvailable;
+};
+
+enum Sampling
+{
+	EdgeRuns,
+	BitByBit,
+	ClockRecovery
+};
+
+struct Case
+{
+	Case( const char* name, U32 capture, Sampling sampling, bool ordered_sets, bool msb_first, bool detect_bit_rate = false, U32 lanes = 1,
+		  U32 threads = 1, bool live = false )
+	:	mName( name ),
+		mCapture( capture ),
+		mSampling( sampling ),
+		mOrderedSets( ordered_sets ),
+		mMsbFirst( msb_first ),
+		mDetectBitRate( detect_bit_rate ),
+		mLanes( lanes ),
+		mThreads( threads ),
+		mLive( live )
+	{
+	}
+
+	const char* mName;
+	U32 mCapture; // index into the capture list
+	Sampling mSampling;
+	bool mOrderedSets;
+	bool mMsbFirst;
+	bool mDetectBitRate; // decode at the rate detected from the first edges instead of the nominal one
+	U32 mLanes;          // decode this many copies of the capture, each LaneDelay samples behind the last, as one link
+	U32 mThreads;        // decode in segments on this many threads, stitched back together
+	bool mLive;          // decode as a capture still running, as the plugin's live mode does, and stop it once the line is idle
+};
+
+// Lanes of the multi-lane cases are lined up on their commas, so the delays must stay under a symbol
+enum { LaneDelay = 7 };
+
+struct Result
+{
+	U64 mSymbols;
+	U64 mInvalidCodes;
+	U64 mDisparityErrors;
+	U64 mLocks;
+	U64 mDigest;
+};
+
+static U32 NextRandom( U32& state )
+{
+	state = state * 1664525 + 1013904223;
+	return state >> 8;
+}
+
+// Size of a .sal channel file's varint for the gap between two edges
+static U32 VarintBytes( U64 delta )
+{
+	U32 bytes = 1;
+	while( delta >= 0x80 )
+	{
+		delta >>= 7;
+		bytes++;
+	}
+	return bytes;
+}
+
+static void QueuePacket( std::vector<U16>& symbols, U32& random_state )
+{
+	// Broadcast frame from a locally administered address, with the local experimental EtherType
+	std::vector<U8> frame = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x8B, 0x10, 0x88, 0xB5 };
+	U32 payload_length = 46 + NextRandom( random_state ) % 256;
+	for( U32 i = 0; i < payload_length; i++ )
+		frame.push_back( U8( NextRandom( random_state ) ) );
+
+	U32 fcs = decode8b10bOrderedSetDecoder::Crc32( frame.data(), frame.size() );
+	for( U32 i = 0; i < 4; i++ )
+		frame.push_back( U8( fcs >> ( 8 * i ) ) );
+
+	U64 packet_start = symbols.size();
+	symbols.push_back( K27_7 );
+	for( U32 i = 0; i < 6; i++ )
+		symbols.push_back( 0x55 );
+	symbols.push_back( 0xD5 );
+	symbols.insert( symbols.end(), frame.begin(), frame.end() );
+
+	// /T/R/, plus a second /R/ so the next ordered set starts on an even symbol
+	symbols.push_back( K29_7 );
+	symbols.push_back( K23_7 );
+	if( ( symbols.size() - packet_start ) & 1 )
+		symbols.push_back( K23_7 );
+}
+
+static void GenerateCapture( CaptureSource& source )
+{
+	const GeneratorSettings& settings = source.mGenerator;
+	U32 random_state = 0x8b10b;
+
+	// Idle and packets at 1000BASE-X spacing, always opening with idle so there is a comma to lock to
+	std::vector<U16> symbols;
+	while( symbols.size() < settings.mSymbols )
+	{
+		U32 idle_sets = ( symbols.empty() || NextRandom( random_state ) % 100 < settings.mIdlePercent ) ? 16 : 6;
+		for( U32 i = 0; i < idle_sets; i++ )
+		{
+			symbols.push_back( K28_5 );
+			symbols.push_back( IdleSecondSymbol );
+		}
+		QueuePacket( symbols, random_state );
+	}
+
+	// Encode, injecting errors as it goes, and lay the bits out on the wire
+	std::vector<U8> wire_bits;
+	wire_bits.reserve( symbols.size() * 10 );
+	source.mSentCodes.clear();
+	std::vector<U64> symbol_first_bits;
+	U8 running_disparity = 0;
+	for( U64 i = 0; i < symbols.size(); i++ )
+	{
+		U16 decoded = symbols[ i ];
+		if( decoded == IdleSecondSymbol )
+			decoded = ( running_disparity == 1 ) ? D16_2 : D5_6;
+
+		U16 code = decode8b10bSymbolUtils::EncodeSymbol( decoded, running_disparity );
+		U32 bit_count = 10;
+		if( settings.mErrorInterval != 0 && ( i + 1 ) % settings.mErrorInterval == 0 )
+		{
+			if( settings.mBitSlips )
+			{
+				bit_count = 9;
+			}
+			else
+			{
+				// Flip the first bit, starting from a random one, that turns the symbol into an invalid code
+				for( U32 j = 0, first = NextRandom( random_state ) % 10; j < 10; j++ )
+				{
+					U16 corrupted = code ^ U16( 1 << ( ( first + j ) % 10 ) );
+					if( !decode8b10bSymbolUtils::IsValid( decode8b10bSymbolUtils::LookupSymbol( corrupted ) ) )
+					{
+						code = corrupted;
+						break;
+					}
+				}
+			}
+		}
+		source.mSentCodes.push_back( code );
+		symbol_first_bits.push_back( wire_bits.size() );
+
+		U16 wire_code = settings.mMsbFirst ? decode8b10bSymbolUtils::ReverseBits10( code ) : code;
+		for( U32 bit = 0; bit < bit_count; bit++ )
+			wire_bits.push_back( U8( ( wire_code >> ( 9 - bit ) ) & 1 ) );
+	}
+
+	// Sample it, with the bit period drifting as configured and every edge moved by up to the jitter either way
+	decode8b10bCapture& capture = source.mCapture;
+	capture.mEdges.clear();
+	capture.mInitialHigh = ( wire_bits[ 0 ] != 0 );
+	capture.mSampleRate = U64( double( source.mBitRate ) * settings.mSamplesPerBit + 0.5 );
+	capture.mDataBytes = 0;
+	source.mSentStarts.clear();
+
+	double ssc_period_bits = double( source.mBitRate ) / 33000.0;
+	double bit_period = settings.mSamplesPerBit * ( 1.0 + settings.mOffsetPpm * 1e-6 );
+	double bit_start = 100.0 + double( settings.mStartOffset );
+	U64 previous_edge = 0;
+	for( U64 bit = 0; bit < wire_bits.size(); bit++ )
+	{
+		if( source.mSentStarts.size() < symbol_first_bits.size() && symbol_first_bits[ source.mSentStarts.size() ] == bit )
+			source.mSentStarts.push_back( U64( bit_start + 0.5 ) );
+
+		U64 edge = U64( bit_start + 0.5 );
+		if( settings.mSscPpm != 0 )
+		{
+			double phase = fmod( double( bit ), ssc_period_bits ) / ssc_period_bits;
+			double triangle = phase < 0.5 ? 2 * phase : 2 - 2 * phase;
+			bit_start += bit_period * ( 1.0 + settings.mSscPpm * 1e-6 * triangle );
+		}
+		else
+		{
+			bit_start += bit_period;
+		}
+
+		if( bit == 0 || wire_bits[ bit ] == wire_bits[ bit - 1 ] )
+			continue;
+
+		if( settings.mJitter != 0 )
+			edge = U64( S64( edge ) + S64( NextRandom( random_state ) % ( 2 * settings.mJitter + 1 ) ) - S64( settings.mJitter ) );
+		capture.mDataBytes += VarintBytes( edge - previous_edge - 1 );
+		capture.mEdges.push_back( edge );
+		previous_edge = edge;
+	}
+
+	// Closing edge so the last run has an end
+	capture.mEdges.push_back( U64( bit_start + 0.5 ) );
+}
+
+// Folds every decoded record into a digest and keeps the counts the golden file records
+class DigestSink : public decode8b10bOrderedSetDecoder::Listener, public decode8b10bLaneDeskew::Listener
+{
+public:
+	DigestSink( bool ordered_sets, FILE* dump )
+	:	mLaneCount( 1 ),
+		mOrderedSets( ordered_sets ),
+		mDump( dump )
+	{
+		mResult.mSymbols = 0;
+		mResult.mInvalidCodes = 0;
+		mResult.mDisparityErrors = 0;
+		mResult.mLocks = 0;
+		mResult.mDigest = 0xCBF29CE484222325ULL; // FNV-1a
+	}
+
+	void Finish()
+	{
+		mOrderedSetDecoder.Flush( *this );
+	}
+
+	void OnSymbolDecoded( const decode8b10bSymbolDecoder::Symbol& symbol )
+	{
+		mSymbols.push_back( symbol );
+		Count( symbol );
+
+		if( mOrderedSets )
+			mOrderedSetDecoder.AddSymbol( symbol, *this );
+		else
+			OnSymbol( symbol );
+	}
+
+	void OnSyncEvent( const decode8b10bSymbolDecoder::SyncEvent& sync )
+	{
+		if( sync.mAcquired )
+			mResult.mLocks++;
+		Add( sync.mUnlockedSince );
+		Add( sync.mLockedAt );
+		Add( sync.mHuntedBits );
+		Add( sync.mCause * 2 + sync.mAcquired );
+
+		if( mDump != nullptr )
+			fprintf( mDump, "sync %llu %llu %llu %d %d\n", ( unsigned long long )sync.mUnlockedSince, ( unsigned long long )sync.mLockedAt,
+					 ( unsigned long long )sync.mHuntedBits, int( sync.mCause ), int( sync.mAcquired ) );
+	}
+
+	void OnSyncLost( U64 /*sample*/ )
+	{
+		mOrderedSetDecoder.Flush( *this );
+	}
+
+	virtual void OnSymbol( const decode8b10bOrderedSetDecoder::Symbol& symbol )
+	{
+		Add( symbol.mStart );
+		Add( symbol.mEnd );
+		Add( ( U64( symbol.mCode ) << 16 ) | ( U64( symbol.mDecoded ) << 4 ) | symbol.mError );
+
+		if( mDump != nullptr )
+			fprintf( mDump, "symbol %llu %llu %03X %03X %u\n", ( unsigned long long )symbol.mStart, ( unsigned long long )symbol.mEnd,
+					 unsigned( symbol.mCode ), unsigned( symbol.mDecoded ), unsigned( symbol.mError ) );
+	}
+
+	virtual void OnOrderedSet( const decode8b10bOrderedSetDecoder::OrderedSet& ordered_set )
+	{
+		Add( ordered_set.mStart );
+		Add( ordered_set.mEnd );
+		Add( ( U64( ordered_set.mType ) << 16 ) | ordered_set.mConfigWord );
+
+		if( mDump != nullptr )
+			fprintf( mDump, "ordered_set %llu %llu %s %04X\n", ( unsigned long long )ordered_set.mStart, ( unsigned long long )ordered_set.mEnd,
+					 decode8b10bOrderedSetDecoder::GetOrderedSetName( ordered_set.mType ), unsigned( ordered_set.mConfigWord ) );
+	}
+
+	virtual void OnPacket( const decode8b10bOrderedSetDecoder::Packet& packet )
+	{
+		Add( packet.mStart );
+		Add( packet.mEnd );
+		Add( ( U64( packet.mErrorCount ) << 32 ) | ( packet.mFrameOffset << 3 ) | ( packet.mTerminated << 2 ) | ( packet.mPreambleValid << 1 ) |
+			 packet.mCrcValid );
+		for( U8 octet : packet.mBytes )
+			Add( octet );
+
+		if( mDump != nullptr )
+			fprintf( mDump, "packet %llu %llu %llu bytes, %u errors, crc %d, terminated %d\n", ( unsigned long long )packet.mStart,
+					 ( unsigned long long )packet.mEnd, ( unsigned long long )packet.mBytes.size(), packet.mErrorCount, int( packet.mCrcValid ),
+					 int( packet.mTerminated ) );
+	}
+
+	// Every lane's symbol counts, lane 0's are compared with the generated traffic
+	virtual void OnColumn( const decode8b10bLaneDeskew::Column& column )
+	{
+		mSymbols.push_back( column.mSymbols[ 0 ] );
+		for( U32 lane = 0; lane < mLaneCount; lane++ )
+		{
+			Count( column.mSymbols[ lane ] );
+			OnSymbol( column.mSymbols[ lane ] );
+		}
+		Add( column.mAlignmentError );
+	}
+
+	virtual void OnAlignment( const decode8b10bLaneDeskew::Alignment& alignment )
+	{
+		if( alignment.mAcquired )
+			mResult.mLocks++;
+		Add( alignment.mUnalignedSince );
+		Add( alignment.mAlignedAt );
+		Add( alignment.mDroppedSymbols );
+		for( U32 lane = 0; lane < mLaneCount; lane++ )
+			Add( alignment.mSkew[ lane ] );
+		Add( alignment.mAcquired );
+
+		if( mDump != nullptr )
+			fprintf( mDump, "alignment %llu %llu %llu %d\n", ( unsigned long long )alignment.mUnalignedSince, ( unsigned long long )alignment.mAlignedAt,
+					 ( unsigned long long )alignment.mDroppedSymbols, int( alignment.mAcquired ) );
+	}
+
+	Result mResult;
+	std::vector<decode8b10bSymbolDecoder::Symbol> mSymbols; // everything decoded, for the comparison with generated traffic
+	U32 mLaneCount; // multi-lane cases only
+
+protected:
+	void Count( const decode8b10bSymbolDecoder::Symbol& symbol )
+	{
+		mResult.mSymbols++;
+		if( symbol.mError == decode8b10bSymbolDecoder::InvalidCodeError )
+			mResult.mInvalidCodes++;
+		else if( symbol.mError != decode8b10bSymbolDecoder::NoSymbolError )
+			mResult.mDisparityErrors++;
+	}
+
+	void Add( U64 value )
+	{
+		for( U32 i = 0; i < 8; i++ )
+		{
+			mResult.mDigest ^= U8( value >> ( 8 * i ) );
+			mResult.mDigest *= 0x100000001B3ULL;
+		}
+	}
+
+	bool mOrderedSets;
+	FILE* mDump;
+	decode8b10bOrderedSetDecoder mOrderedSetDecoder;
+};
+
+// Plays the lanes' results back as the plugin does: a single lane's straight onto the sink, several lanes' through
+// the deskew
+class LaneSink
+{
+public:
+	LaneSink( DigestSink& sink, decode8b10bLaneDeskew* deskew )
+	:	mEndSample( 0 ),
+		mSink( sink ),
+		mDeskew( deskew )
+	{
+	}
+
+	void OnLaneEvent( U32 lane, const decode8b10bLaneQueue::Event& event )
+	{
+		if( mDeskew == nullptr )
+			decode8b10bLaneQueue::Deliver( event, mSink );
+		else if( event.mType == decode8b10bLaneQueue::SyncLostEvent )
+			mDeskew->LoseLane( lane, event.mSymbol.mStart, mSink );
+		else if( event.mType == decode8b10bLaneQueue::SymbolDecodedEvent )
+		{
+			mEndSample = std::max( mEndSample, event.mSymbol.mEnd );
+			mDeskew->AddSymbol( lane, event.mSymbol, mSink );
+		}
+	}
+
+	U64 mEndSample;
+
+protected:
+	DigestSink& mSink;
+	decode8b10bLaneDeskew* mDeskew;
+};
+
+// Thrown where the SDK would end a worker thread checking whether it should exit
+struct CaptureStopped
+{
+};
+
+// Decodes as the plugin's worker thread does: each lane is decoded on a thread of its own from the edges handed
+// to it a batch at a time, with the results played back onto sink here in between. Live, the capture is stopped
+// once the line has gone quiet and the decoders have caught up with it; the stop has to end the decode with
+// everything decoded so far delivered. A watchdog fails the run rather than let a hung decode hang the check.
+static void DecodePipeline( const Case& test_case, const decode8b10bCapture& capture, U64 bit_period, DigestSink& sink, std::string& problem )
+{
+	std::mutex mutex;
+	std::condition_variable condition;
+	bool done = false;
+	std::thread watchdog( [&]() {
+		std::unique_lock<std::mutex> lock( mutex );
+		if( !condition.wait_for( lock, std::chrono::seconds( 30 ), [&]() { return done; } ) )
+		{
+			printf( "%-32s FAIL: decode did not finish\n", test_case.mName );
+			fflush( stdout );
+			std::_Exit( 1 );
+		}
+	} );
+
+	// Every lane is a copy of the capture, each LaneDelay samples behind the last
+	U32 lane_count = test_case.mLanes;
+	std::vector<std::vector<U64>> lane_edges( lane_count, capture.mEdges );
+	std::vector<decode8b10bEdgeSource> sources;
+	sources.reserve( lane_count );
+	U64 start_samples[ decode8b10bDecodePipeline::MaxLanes ];
+	BitState start_states[ decode8b10bDecodePipeline::MaxLanes ];
+	for( U32 lane = 0; lane < lane_count; lane++ )
+	{
+		for( U64& edge : lane_edges[ lane ] )
+			edge += lane * LaneDelay;
+		sources.push_back( decode8b10bEdgeSource( lane_edges[ lane ], capture.mInitialHigh ? BIT_HIGH : BIT_LOW ) );
+		start_samples[ lane ] = sources[ lane ].GetSampleNumber();
+		start_states[ lane ] = sources[ lane ].GetBitState();
+	}
+
+	decode8b10bLaneDeskew deskew;
+	if( lane_count > 1 )
+	{
+		deskew.Reset( lane_count, K28_5, ( bit_period * 10 ) >> 32, 0 );
+		sink.mLaneCount = lane_count;
+	}
+	LaneSink lane_sink( sink, lane_count > 1 ? &deskew : nullptr );
+
+	try
+	{
+		decode8b10bDecodePipeline pipeline;
+		pipeline.Start( lane_count, test_case.mLive, [&]( U32 lane, decode8b10bEdgeRing& ring, decode8b10bLaneQueue& queue ) {
+			decode8b10bRingSource edges( ring, start_samples[ lane ], start_states[ lane ] );
+			decode8b10bDecoderCore<decode8b10bRingSource, decode8b10bLaneQueue> core( edges, queue );
+			core.Start( bit_period, test_case.mMsbFirst, 4, 16 );
+			if( test_case.mSampling == ClockRecovery )
+				core.DecodeClockRecovery( 5 );
+			else if( test_case.mSampling == BitByBit )
+				core.DecodeBitByBit();
+			else
+				core.DecodeEdgeRuns();
+			if( lane_count == 1 )
+				core.Finish();
+		} );
+
+		bool quiet = false;
+		bool stopped = false;
+		for( U32 spins = 0; ; )
+		{
+			bool any_fed = false;
+			for( U32 lane = 0; lane < lane_count; lane++ )
+			{
+				bool fed;
+				pipeline.Fill( lane, sources[ lane ], test_case.mLive, fed );
+				any_fed = any_fed || fed;
+			}
+
+			bool idle = test_case.mLive && pipeline.TakeIdle();
+			bool took;
+			if( !pipeline.Drain( lane_sink, took ) )
+				break;
+
+			// Gone idle after every edge had been handed over, so there is nothing left for the decoders to report
+			stopped = stopped || ( idle && quiet );
+			quiet = !sources[ 0 ].DoMoreTransitionsExistInCurrentData();
+			if( any_fed || took )
+			{
+				spins = 0;
+				continue;
+			}
+
+			// Where the plugin checks whether it should exit
+			if( stopped )
+				throw CaptureStopped();
+			decode8b10bEdgeRing::Backoff( ++spins );
+		}
+		pipeline.Finish();
+
+		if( test_case.mLive )
+			problem = "live decode ended without being stopped";
+		else if( lane_count > 1 )
+			deskew.Finish( lane_sink.mEndSample, sink );
+		else
+			sink.Finish();
+	}
+	catch( const CaptureStopped& )
+	{
+	}
+
+	{
+		std::lock_guard<std::mutex> lock( mutex );
+		done = true;
+		condition.notify_all();
+	}
+	watchdog.join();
+}
+
+static double DecodeCase( const Case& test_case, const CaptureSource& source, DigestSink& sink, std::string& problem )
+{
+	const decode8b10bCapture& capture = source.mCapture;
+	auto start = std::chrono::steady_clock::now();
+
+	U64 bit_rate = source.mBitRate;
+	if( test_case.mDetectBitRate )
+	{
+		U64 num_edges = std::min<U64>( capture.mEdges.size(), decode8b10bBitRateDetector::DetectionEdges );
+		std::vector<U64> edges( capture.mEdges.begin(), capture.mEdges.begin() + num_edges );
+		decode8b10bBitRateDetector::Estimate estimate = decode8b10bBitRateDetector::Detect( edges, capture.mSampleRate );
+		if( !estimate.mDetected )
+		{
+			problem = "bit rate not detected";
+			return 0.0;
+		}
+		bit_rate = estimate.mBitRate;
+	}
+
+	if( test_case.mLive || test_case.mLanes > 1 )
+	{
+		DecodePipeline( test_case, capture, decode8b10bSymbolDecoder::GetBitPeriod( capture.mSampleRate, bit_rate ), sink, problem );
+	}
+	else if( test_case.mThreads > 1 )
+	{
+		decode8b10bSegmentDecoder::Settings settings = { decode8b10bSymbolDecoder::GetBitPeriod( capture.mSampleRate, bit_rate ), test_case.mMsbFirst, 4, 16,
+														 test_case.mSampling == ClockRecovery ? decode8b10bSegmentDecoder::ClockRecoverySampling :
+														 test_case.mSampling == BitByBit ? decode8b10bSegmentDecoder::PerBitSampling :
+																						   decode8b10bSegmentDecoder::EdgeRunSampling,
+														 5 };
+
+		// The shortest segments allowed, so the captures cross as many boundaries as they can
+		decode8b10bSegmentDecoder decoder( capture.mEdges, capture.mInitialHigh ? BIT_HIGH : BIT_LOW );
+		decoder.Decode( settings, test_case.mThreads, sink, 0 );
+		sink.Finish();
+		decoder.Finish( sink );
+		if( decoder.GetBoundaryCuts() != 0 )
+			problem = std::to_string( decoder.GetBoundaryCuts() ) + " of " + std::to_string( decoder.GetSegmentCount() - 1 ) + " segment boundaries cut";
+	}
+	else if( capture.mEdges.size() >= 2 )
+	{
+		decode8b10bEdgeSource edges( capture.mEdges, capture.mInitialHigh ? BIT_HIGH : BIT_LOW );
+		decode8b10bDecoderCore<decode8b10bEdgeSource, DigestSink> core( edges, sink );
+		core.Start( decode8b10bSymbolDecoder::GetBitPeriod( capture.mSampleRate, bit_rate ), test_case.mMsbFirst, 4, 16 );
+
+		if( test_case.mSampling == ClockRecovery )
+			core.DecodeClockRecovery( 5 );
+		else if( test_case.mSampling == BitByBit )
+			core.DecodeBitByBit();
+		else
+			core.DecodeEdgeRuns();
+
+		sink.Finish();
+		core.Finish();
+	}
+	return std::chrono::duration<double>( std::chrono::steady_clock::now() - start ).count();
+}
+
+// Every decoded symbol must be the one sent at its place on the wire, and nothing may be missing after the
+// first comma. Only for generated captures without bit slips.
+static bool MatchesSentCodes( const std::vector<decode8b10bSymbolDecoder::Symbol>& decoded, const CaptureSource& source, std::string& problem )
+{
+	if( decoded.empty() )
+	{
+		problem = "nothing decoded";
+		return false;
+	}
+
+	const std::vector<U64>& starts = source.mSentStarts;
+	U64 half_symbol = U64( 5 * source.mGenerator.mSamplesPerBit );
+	U64 index = 0;
+	U64 first_index = 0;
+	for( U64 i = 0; i < decoded.size(); i++ )
+	{
+		while( index + 1 < starts.size() && starts[ index + 1 ] <= decoded[ i ].mStart + half_symbol )
+			index++;
+		if( i == 0 )
+			first_index = index;
+
+		U64 distance = std::max( starts[ index ], decoded[ i ].mStart ) - std::min( starts[ index ], decoded[ i ].mStart );
+		if( index != first_index + i || distance > half_symbol )
+		{
+			problem = "symbol " + std::to_string( i ) + " is not where it was sent";
+			return false;
+		}
+		if( decoded[ i ].mCode != source.mSentCodes[ index ] )
+		{
+			problem = "symbol " + std::to_string( i ) + " differs from the one sent";
+			return false;
+		}
+	}
+
+	if( first_index > 2 || first_index + decoded.size() != source.mSentCodes.size() )
+	{
+		problem = "decoded symbols " + std::to_string( first_index ) + " to " + std::to_string( first_index + decoded.size() ) + " of " +
+				  std::to_string( source.mSentCodes.size() ) + " sent";
+		return false;
+	}
+	return true;
+}
+
+static bool SameResult( const Result& a, const Result& b )
+{
+	return a.mSymbols == b.mSymbols && a.mInvalidCodes == b.mInvalidCodes && a.mDisparityErrors == b.mDisparityErrors && a.mLocks == b.mLocks &&
+		   a.mDigest == b.mDigest;
+}
+
+static bool LoadGolden( const std::string& path, std::map<std::string, Result>& golden )
+{
+	FILE* file = fopen( path.c_str(), "r" );
+	if( file == nullptr )
+		return false;
+
+	char line[ 512 ];
+	while( fgets( line, sizeof( line ), file ) != nullptr )
+	{
+		if( line[ 0 ] == '#' || line[ 0 ] == '\n' )
+			continue;
+
+		char name[ 256 ];
+		unsigned long long symbols, invalid_codes, disparity_errors, locks, digest;
+		if( sscanf( line, "%255s %llu %llu %llu %llu %llx", name, &symbols, &invalid_codes, &disparity_errors, &locks, &digest ) != 6 )
+			continue;
+		Result result = { symbols, invalid_codes, disparity_errors, locks, digest };
+		golden[ name ] = result;
+	}
+	fclose( file );
+	return true;
+}
+
+static bool SaveGolden( const std::string& path, const std::vector<Case>& cases, const std::map<std::string, Result>& results )
+{
+	FILE* file = fopen( path.c_str(), "w" );
+	if( file == nullptr )
+		return false;
+
+	fprintf( file, "# Decoded stream digests for decode8b10bRegress, rewritten by decode8b10bRegress --update\n" );
+	fprintf( file, "# case symbols invalid_codes disparity_errors locks digest\n" );
+	for( const Case& test_case : cases )
+	{
+		std::map<std::string, Result>::const_iterator it = results.find( test_case.mName );
+		if( it == results.end() )
+			continue;
+		const Result& result = it->second;
+		fprintf( file, "%s %llu %llu %llu %llu %016llx\n", test_case.mName, ( unsigned long long )result.mSymbols, ( unsigned long long )result.mInvalidCodes,
+				 ( unsigned long long )result.mDisparityErrors, ( unsigned long long )result.mLocks, ( unsigned long long )result.mDigest );
+	}
+	fclose( file );
+	return true;
+}
+
+static void PrintUsage()
+{
+	printf( "usage: decode8b10bRegress [options]\n"
+			"\n"
+			"  --update          rewrite the golden file from this build's results\n"
+			"  --golden FILE     golden digests (default " DECODE8B10B_SOURCE_DIR "/tools/golden/decode8b10bRegress.txt)\n"
+			"  --capture FILE    the igniton_test capture (default " DECODE8B10B_SOURCE_DIR "/igniton_test.sal)\n"
+			"  --dump DIR        write every decoded stream as text to DIR/<case>.txt, for diffing two builds\n"
+			"  --filter TEXT     only run cases whose name contains TEXT\n"
+			"  --repeat N        decode each case N times and report the fastest (default 3)\n" );
+}
+
+int main( int argc, char** argv )
+{
+	std::string golden_path = DECODE8B10B_SOURCE_DIR "/tools/golden/decode8b10bRegress.txt";
+	std::string capture_path = DECODE8B10B_SOURCE_DIR "/igniton_test.sal";
+	const char* dump_dir = nullptr;
+	const char* filter = nullptr;
+	bool update = false;
+	U32 repeat = 3;
+
+	for( int i = 1; i < argc; i++ )
+	{
+		const char* arg = argv[ i ];
+		bool has_value = ( i + 1 < argc );
+
+		if( !strcmp( arg, "--update" ) )
+			update = true;
+		else if( !strcmp( arg, "--golden" ) && has_value )
+			golden_path = argv[ ++i ];
+		else if( !strcmp( arg, "--capture" ) && has_value )
+			capture_path = argv[ ++i ];
+		else if( !strcmp( arg, "--dump" ) && has_value )
+			dump_dir = argv[ ++i ];
+		else if( !strcmp( arg, "--filter" ) && has_value )
+			filter = argv[ ++i ];
+		else if( !strcmp( arg, "--repeat" ) && has_value )
+			repeat = std::max<U32>( 1, U32( strtoul( argv[ ++i ], nullptr, 10 ) ) );
+		else
+		{
+			PrintUsage();
+			return 2;
+		}
+	}
+
+	// Name, bit rate, generated,
+	// { symbols, samples per bit, idle %, error interval, bit slips, MSB first, jitter, offset ppm, SSC ppm, start offset }
+	CaptureSource sources[] = {
+		{ "igniton_test", 10000000, false, {} },
+		{ "clean_4x", 10000000, true, { 200000, 4, 50, 0, false, false, 0, 0, 0, 0 } },
+		{ "clean_10x_jitter", 10000000, true, { 200000, 10, 50, 0, false, false, 2, 0, 0, 0 } },
+		{ "clean_25x_msb", 10000000, true, { 200000, 25, 50, 0, false, true, 5, 0, 0, 0 } },
+		{ "code_errors_10x", 10000000, true, { 200000, 10, 20, 997, false, false, 2, 0, 0, 0 } },
+		{ "bit_slips_10x", 10000000, true, { 200000, 10, 20, 4001, true, false, 2, 0, 0, 0 } },
+		{ "offset_2.5x", 10000000, true, { 200000, 2.5, 50, 0, false, false, 0, 2000, 0, 0 } },
+		{ "ssc_3.3x", 10000000, true, { 200000, 3.3, 50, 0, false, false, 0, -300, 5000, 0 } },
+		{ "gigabit_2.4x", 1250000000, true, { 200000, 2.4, 50, 0, false, false, 0, 0, 0, 6000000000ULL } },
+	};
+	const U32 num_sources = sizeof( sources ) / sizeof( sources[ 0 ] );
+
+	std::vector<Case> cases = {
+		{ "igniton_test/edge-runs", 0, EdgeRuns, false, false },
+		{ "igniton_test/bit-by-bit", 0, BitByBit, false, false },
+		{ "igniton_test/ordered-sets", 0, EdgeRuns, true, false },
+		{ "igniton_test/clock-recovery", 0, ClockRecovery, false, false },
+		{ "clean_4x/edge-runs", 1, EdgeRuns, false, false },
+		{ "clean_4x/bit-by-bit", 1, BitByBit, false, false },
+		{ "clean_4x/clock-recovery", 1, ClockRecovery, false, false },
+		{ "clean_10x_jitter/edge-runs", 2, EdgeRuns, false, false },
+		{ "clean_10x_jitter/bit-by-bit", 2, BitByBit, false, false },
+		{ "clean_10x_jitter/ordered-sets", 2, EdgeRuns, true, false },
+		{ "clean_10x_jitter/clock-recovery", 2, ClockRecovery, false, false },
+		{ "clean_25x_msb/edge-runs", 3, EdgeRuns, false, true },
+		{ "code_errors_10x/edge-runs", 4, EdgeRuns, false, false },
+		{ "code_errors_10x/ordered-sets", 4, EdgeRuns, true, false },
+		{ "bit_slips_10x/edge-runs", 5, EdgeRuns, false, false },
+		{ "bit_slips_10x/bit-by-bit", 5, BitByBit, false, false },
+		{ "bit_slips_10x/clock-recovery", 5, ClockRecovery, false, false },
+		{ "offset_2.5x/clock-recovery", 6, ClockRecovery, false, false },
+		{ "offset_2.5x/edge-runs", 6, EdgeRuns, false, false },
+		{ "offset_2.5x/bit-by-bit", 6, BitByBit, false, false },
+		{ "ssc_3.3x/clock-recovery", 7, ClockRecovery, false, false },
+		{ "gigabit_2.4x/edge-runs", 8, EdgeRuns, false, false },
+		{ "gigabit_2.4x/bit-by-bit", 8, BitByBit, false, false },
+		{ "gigabit_2.4x/clock-recovery", 8, ClockRecovery, false, false },
+		{ "clean_4x/detected-rate", 1, EdgeRuns, false, false, true },
+		{ "clean_10x_jitter/detected-rate", 2, EdgeRuns, false, false, true },
+		{ "offset_2.5x/detected-rate", 6, ClockRecovery, false, false, true },
+		{ "ssc_3.3x/detected-rate", 7, ClockRecovery, false, false, true },
+		{ "clean_10x_jitter/4-lanes", 2, EdgeRuns, false, false, false, 4 },
+		{ "code_errors_10x/4-lanes", 4, EdgeRuns, false, false, false, 4 },
+		{ "ssc_3.3x/2-lanes", 7, ClockRecovery, false, false, false, 2 },
+		{ "clean_10x_jitter/segmented", 2, EdgeRuns, false, false, false, 1, 4 },
+		{ "code_errors_10x/segmented", 4, EdgeRuns, true, false, false, 1, 4 },
+		{ "bit_slips_10x/segmented", 5, BitByBit, false, false, false, 1, 4 },
+		{ "gigabit_2.4x/segmented", 8, EdgeRuns, false, false, false, 1, 4 },
+		{ "ssc_3.3x/segmented", 7, ClockRecovery, false, false, false, 1, 4 },
+		{ "clean_10x_jitter/live-stopped", 2, EdgeRuns, false, false, false, 1, 1, true },
+		{ "code_errors_10x/live-stopped", 4, EdgeRuns, true, false, false, 1, 1, true },
+	};
+
+	for( U32 i = 0; i < num_sources; i++ )
+	{
+		CaptureSource& source = sources[ i ];
+		if( source.mGenerated )
+		{
+			GenerateCapture( source );
+			source.mAvailable = true;
+		}
+		else
+		{
+			source.mAvailable = source.mCapture.Load( capture_path.c_str(), -1, 0, false );
+		}
+	}
+
+	std::map<std::string, Result> golden;
+	if( !LoadGolden( golden_path, golden ) && !update )
+		fprintf( stderr, "cannot read %s, every case will be reported as new\n", golden_path.c_str() );
+
+	std::map<std::string, Result> results = golden;
+	U32 failures = 0;
+
+	printf( "%-32s %10s %10s %10s  %s\n", "Case", "Symbols", "Msym/s", "s/MB", "Result" );
+	for( const Case& test_case : cases )
+	{
+		if( filter != nullptr && strstr( test_case.mName, filter ) == nullptr )
+			continue;
+
+		const CaptureSource& source = sources[ test_case.mCapture ];
+		if( !source.mAvailable )
+		{
+			printf( "%-32s %10s %10s %10s  FAIL: capture not loaded\n", test_case.mName, "-", "-", "-" );
+			failures++;
+			continue;
+		}
+
+		// Only the first run is dumped and checked, the others are for timing
+		double best_seconds = 0;
+		Result result;
+		std::string problem;
+		for( U32 run = 0; run < repeat; run++ )
+		{
+			FILE* dump = nullptr;
+			if( dump_dir != nullptr && run == 0 )
+			{
+				std::string dump_name = std::string( dump_dir ) + "/" + test_case.mName + ".txt";
+				std::replace( dump_name.begin() + strlen( dump_dir ) + 1, dump_name.end(), '/', '_' );
+				dump = fopen( dump_name.c_str(), "w" );
+			}
+
+			DigestSink sink( test_case.mOrderedSets, dump );
+			double seconds = DecodeCase( test_case, source, sink, problem );
+			if( dump != nullptr )
+				fclose( dump );
+
+			if( run == 0 )
+			{
+				result = sink.mResult;
+				best_seconds = seconds;
+				if( problem.empty() && source.mGenerated && source.mGenerator.mErrorInterval == 0 )
+					MatchesSentCodes( sink.mSymbols, source, problem );
+			}
+			best_seconds = std::min( best_seconds, seconds );
+		}
+
+		std::map<std::string, Result>::const_iterator expected = golden.find( test_case.mName );
+		if( problem.empty() && !update )
+		{
+			if( expected == golden.end() )
+				problem = "no golden entry";
+			else if( !SameResult( expected->second, result ) )
+				problem = "differs from golden (" + std::to_string( expected->second.mSymbols ) + " symbols, " +
+						  std::to_string( expected->second.mInvalidCodes + expected->second.mDisparityErrors ) + " errors, " +
+						  std::to_string( expected->second.mLocks ) + " locks expected)";
+		}
+		results[ test_case.mName ] = result;
+
+		double capture_mb = double( source.mCapture.mDataBytes ) / ( 1 << 20 );
+		printf( "%-32s %10llu %10.2f %10.4f  %s%s\n", test_case.mName, ( unsigned long long )result.mSymbols,
+				best_seconds > 0 ? double( result.mSymbols ) / best_seconds / 1e6 : 0.0, capture_mb > 0 ? best_seconds / capture_mb : 0.0,
+				problem.empty() ? "ok" : "FAIL: ", problem.c_str() );
+		if( !problem.empty() )
+			failures++;
+	}
+
+	if( update )
+	{
+		if( !SaveGolden( golden_path, cases, results ) )
+		{
+			fprintf( stderr, "cannot write %s\n", golden_path.c_str() );
+			return 1;
+		}
+		printf( "golden digests written to %s\n", golden_path.c_str() );
+	}
+
+	if( failures != 0 )
+		printf( "%u case(s) failed\n", failures );
+	return failures != 0 ? 1 : 0;
+}